@@ -0,0 +1,18 @@
+# included at the end of each benchmark CMakeLists.txt, once the ${PROJECT_NAME}
+# executable is defined. 'make bench-json' runs all benchmarks and writes their
+# results in ${PHARE_BENCH_OUTPUT_DIR}/<benchmark>.json
+
+target_include_directories(${PROJECT_NAME} PRIVATE
+  $<BUILD_INTERFACE:${PHARE_PROJECT_DIR}/bench>
+  )
+
+target_link_libraries(${PROJECT_NAME} PRIVATE benchmark)
+
+add_custom_target(run-${PROJECT_NAME}
+  COMMAND ${PROJECT_NAME}
+          --benchmark_out=${PHARE_BENCH_OUTPUT_DIR}/${PROJECT_NAME}.json
+          --benchmark_out_format=json
+  DEPENDS ${PROJECT_NAME}
+  )
+
+add_dependencies(bench-json run-${PROJECT_NAME})
@@ -0,0 +1,110 @@
+#ifndef PHARE_BENCH_BENCH_UTILITIES_H
+#define PHARE_BENCH_BENCH_UTILITIES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+#include <benchmark/benchmark.h>
+
+#include "data/ndarray/ndarray_vector.h"
+#include "data/particles/particle_array.h"
+
+namespace PHARE
+{
+namespace bench
+{
+    template<std::size_t dim>
+    using NdArray = std::conditional_t<
+        dim == 1, core::NdArrayVector1D<>,
+        std::conditional_t<dim == 2, core::NdArrayVector2D<>, core::NdArrayVector3D<>>>;
+
+
+
+    //! @return an array of dim elements all equal to value
+    template<std::size_t dim, typename T>
+    std::array<T, dim> filled(T value)
+    {
+        std::array<T, dim> array;
+        array.fill(value);
+        return array;
+    }
+
+
+
+    /** @return particlesPerCell particles per cell, uniformly distributed in the cells
+     * [0, nbrCells[ of each direction, with unit weight and charge and velocities uniformly
+     * distributed in [-1, 1]. The seed is fixed so that all runs use the same particles.
+     */
+    template<std::size_t dim>
+    core::ParticleArray<dim> uniformParticles(std::uint32_t nbrCells, std::size_t particlesPerCell)
+    {
+        std::size_t nbrParticles = particlesPerCell;
+        for (auto iDim = 0u; iDim < dim; ++iDim)
+            nbrParticles *= nbrCells;
+
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> cell(0, static_cast<int>(nbrCells) - 1);
+        std::uniform_real_distribution<float> delta(0, 1);
+        std::uniform_real_distribution<double> velocity(-1, 1);
+
+        core::ParticleArray<dim> particles(nbrParticles);
+        for (auto&& particle : particles)
+        {
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                particle.iCell[iDim] = cell(gen);
+                particle.delta[iDim] = delta(gen);
+            }
+            particle.weight = 1.;
+            particle.charge = 1.;
+            particle.v      = {{velocity(gen), velocity(gen), velocity(gen)}};
+        }
+        return particles;
+    }
+
+
+
+    /** @brief patchSizes gives the number of cells per direction of the benchmarked patches,
+     * so that patches of all dimensions have comparable numbers of cells.
+     */
+    template<std::size_t dim>
+    constexpr std::array<std::int64_t, 2> patchSizes()
+    {
+        if constexpr (dim == 1)
+            return {{100, 1000}};
+        else if constexpr (dim == 2)
+            return {{16, 64}};
+        else
+            return {{8, 24}};
+    }
+
+
+
+    //! benchmark arguments: the number of cells per direction of the patch
+    template<std::size_t dim>
+    void patchArguments(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgNames({"cells"});
+        for (auto cells : patchSizes<dim>())
+            bench->Args({cells});
+    }
+
+
+
+    //! benchmark arguments: the number of cells per direction and of particles per cell
+    template<std::size_t dim>
+    void particleArguments(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgNames({"cells", "ppc"});
+        for (auto cells : patchSizes<dim>())
+            for (auto ppc : {10, 100})
+                bench->Args({cells, ppc});
+    }
+
+} // namespace bench
+} // namespace PHARE
+
+#endif
@@ -0,0 +1,173 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_utilities.h"
+
+#include "data/field/field.h"
+#include "data/grid/gridlayout.h"
+#include "data/grid/gridlayout_impl.h"
+#include "data/ions/ion_population/ion_population.h"
+#include "data/ions/ions.h"
+#include "data/particles/particle_array.h"
+#include "data/vecfield/vecfield.h"
+#include "data_provider.h"
+#include "hybrid/hybrid_quantities.h"
+
+using namespace PHARE::core;
+using namespace PHARE::bench;
+
+
+
+// ions made of nbrPopulations populations on a patch of nbrCells^dim cells, with all
+// moment buffers set and filled with non-zero values
+template<std::size_t dim, std::size_t interpOrder>
+struct IonsBench
+{
+    using Field_t         = Field<NdArray<dim>, HybridQuantity::Scalar>;
+    using VecField_t      = VecField<NdArray<dim>, HybridQuantity>;
+    using GridLayout_t    = GridLayout<GridLayoutImplYee<dim, interpOrder>>;
+    using IonPopulation_t = IonPopulation<ParticleArray<dim>, VecField_t, GridLayout_t>;
+    using Ions_t          = Ions<IonPopulation_t, GridLayout_t>;
+
+    static constexpr std::size_t nbrPopulations = 2;
+
+    // density and flux buffers of a population, or of the ions
+    struct Moments
+    {
+        Moments(std::string const& rhoName, std::string const& vName, GridLayout_t const& layout)
+            : rho{rhoName, HybridQuantity::Scalar::rho,
+                  layout.allocSize(HybridQuantity::Scalar::rho)}
+            , vx{vName + "_x", HybridQuantity::Scalar::Vx,
+                 layout.allocSize(HybridQuantity::Scalar::Vx)}
+            , vy{vName + "_y", HybridQuantity::Scalar::Vy,
+                 layout.allocSize(HybridQuantity::Scalar::Vy)}
+            , vz{vName + "_z", HybridQuantity::Scalar::Vz,
+                 layout.allocSize(HybridQuantity::Scalar::Vz)}
+        {
+            for (auto* field : {&rho, &vx, &vy, &vz})
+                for (auto& value : *field)
+                    value = 1.;
+        }
+
+        Field_t rho, vx, vy, vz;
+    };
+
+
+    static PHARE::initializer::PHAREDict<dim> createIonsDict()
+    {
+        PHARE::initializer::PHAREDict<dim> dict;
+        dict["name"]           = std::string{"ions"};
+        dict["nbrPopulations"] = nbrPopulations;
+        for (auto iPop = 0u; iPop < nbrPopulations; ++iPop)
+        {
+            auto& pop   = dict["pop" + std::to_string(iPop)];
+            pop["name"] = "protons" + std::to_string(iPop);
+            pop["mass"] = 1.;
+            pop["ParticleInitializer"]["name"] = std::string{"MaxwellianParticleInitializer"};
+        }
+        return dict;
+    }
+
+
+    explicit IonsBench(std::uint32_t nbrCells)
+        : layout{filled<dim>(0.1), filled<dim>(nbrCells), Point<double, dim>{}}
+        , ions{createIonsDict()}
+        , ionMoments{ions.densityName(), "ions_bulkVel", layout}
+    {
+        ions.setBuffer(ions.densityName(), &ionMoments.rho);
+        ions.velocity().setBuffer("ions_bulkVel_x", &ionMoments.vx);
+        ions.velocity().setBuffer("ions_bulkVel_y", &ionMoments.vy);
+        ions.velocity().setBuffer("ions_bulkVel_z", &ionMoments.vz);
+
+        populationMoments.reserve(nbrPopulations);
+        for (auto& pop : ions)
+        {
+            auto const& name = pop.name();
+            populationMoments.emplace_back(std::make_unique<Moments>(name + "_rho", name + "_flux",
+                                                                     layout));
+            auto& moments = *populationMoments.back();
+
+            pop.setBuffer(name + "_rho", &moments.rho);
+            pop.flux().setBuffer(name + "_flux_x", &moments.vx);
+            pop.flux().setBuffer(name + "_flux_y", &moments.vy);
+            pop.flux().setBuffer(name + "_flux_z", &moments.vz);
+            pop.setBuffer(name, &pack);
+        }
+    }
+
+
+    std::int64_t nbrCells() const
+    {
+        std::int64_t cells = 1;
+        for (auto iDim = 0u; iDim < dim; ++iDim)
+            cells *= layout.nbrCells()[iDim];
+        return cells;
+    }
+
+
+    GridLayout_t layout;
+    Ions_t ions;
+    Moments ionMoments;
+    std::vector<std::unique_ptr<Moments>> populationMoments;
+
+    // the moments do not need particles, the pack only makes the populations usable
+    ParticleArray<dim> particles;
+    ParticlesPack<ParticleArray<dim>> pack{&particles, &particles, &particles, &particles,
+                                           &particles};
+};
+
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void computeDensity(benchmark::State& state)
+{
+    IonsBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.ions.computeDensity();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void computeBulkVelocity(benchmark::State& state)
+{
+    IonsBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+    bench.ions.computeDensity();
+
+    for (auto _ : state)
+    {
+        bench.ions.computeBulkVelocity();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+// items per second is the number of cells per second
+#define PHARE_IONS_BENCH(dim, order)                                                              \
+    BENCHMARK_TEMPLATE(computeDensity, dim, order)->Apply(patchArguments<dim>);                   \
+    BENCHMARK_TEMPLATE(computeBulkVelocity, dim, order)->Apply(patchArguments<dim>)
+
+PHARE_IONS_BENCH(1, 1);
+PHARE_IONS_BENCH(1, 2);
+PHARE_IONS_BENCH(1, 3);
+PHARE_IONS_BENCH(2, 1);
+PHARE_IONS_BENCH(2, 2);
+PHARE_IONS_BENCH(2, 3);
+PHARE_IONS_BENCH(3, 1);
+PHARE_IONS_BENCH(3, 2);
+PHARE_IONS_BENCH(3, 3);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,203 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "bench_utilities.h"
+
+#include "data/field/field.h"
+#include "data/grid/gridlayout.h"
+#include "data/grid/gridlayout_impl.h"
+#include "data/vecfield/vecfield.h"
+#include "hybrid/hybrid_quantities.h"
+#include "numerics/ampere/ampere.h"
+#include "numerics/faraday/faraday.h"
+#include "numerics/fused_field_solver/fused_field_solver.h"
+#include "numerics/ohm/ohm.h"
+
+using namespace PHARE::core;
+using namespace PHARE::bench;
+
+
+
+// the fields of a patch of nbrCells^dim cells, all set to smooth non-zero values so that the
+// solvers do not work on denormals or divide by zero
+template<std::size_t dim, std::size_t interpOrder>
+struct FieldSolversBench
+{
+    using Field_t      = Field<NdArray<dim>, HybridQuantity::Scalar>;
+    using VecField_t   = VecField<NdArray<dim>, HybridQuantity>;
+    using GridLayout_t = GridLayout<GridLayoutImplYee<dim, interpOrder>>;
+
+    struct VecFieldData
+    {
+        VecFieldData(std::string name, HybridQuantity::Vector qty, GridLayout_t const& layout)
+            : x{name + "_x", HybridQuantity::componentsQuantities(qty)[0],
+                layout.allocSize(HybridQuantity::componentsQuantities(qty)[0])}
+            , y{name + "_y", HybridQuantity::componentsQuantities(qty)[1],
+                layout.allocSize(HybridQuantity::componentsQuantities(qty)[1])}
+            , z{name + "_z", HybridQuantity::componentsQuantities(qty)[2],
+                layout.allocSize(HybridQuantity::componentsQuantities(qty)[2])}
+            , vecfield{name, qty}
+        {
+            vecfield.setBuffer(name + "_x", &x);
+            vecfield.setBuffer(name + "_y", &y);
+            vecfield.setBuffer(name + "_z", &z);
+            for (auto* field : {&x, &y, &z})
+                fill(*field);
+        }
+
+        Field_t x, y, z;
+        VecField_t vecfield;
+    };
+
+    static void fill(Field_t& field)
+    {
+        auto i = 0.;
+        for (auto& value : field)
+            value = 1. + 0.5 * std::sin(0.1 * ++i);
+    }
+
+
+    explicit FieldSolversBench(std::uint32_t nbrCells)
+        : layout{filled<dim>(0.1), filled<dim>(nbrCells), Point<double, dim>{}}
+    {
+        fill(n);
+        fill(Pe);
+        faraday.setLayout(&layout);
+        ampere.setLayout(&layout);
+        ohm.setLayout(&layout);
+        fused.setLayout(&layout);
+    }
+
+    std::int64_t nbrCells() const
+    {
+        std::int64_t cells = 1;
+        for (auto iDim = 0u; iDim < dim; ++iDim)
+            cells *= layout.nbrCells()[iDim];
+        return cells;
+    }
+
+    GridLayout_t layout;
+
+    VecFieldData B{"B", HybridQuantity::Vector::B, layout};
+    VecFieldData Bnew{"Bnew", HybridQuantity::Vector::B, layout};
+    VecFieldData E{"E", HybridQuantity::Vector::E, layout};
+    VecFieldData Enew{"Enew", HybridQuantity::Vector::E, layout};
+    VecFieldData J{"J", HybridQuantity::Vector::J, layout};
+    VecFieldData Ve{"Ve", HybridQuantity::Vector::V, layout};
+    Field_t n{"n", HybridQuantity::Scalar::rho, layout.allocSize(HybridQuantity::Scalar::rho)};
+    Field_t Pe{"Pe", HybridQuantity::Scalar::P, layout.allocSize(HybridQuantity::Scalar::P)};
+
+    Faraday<GridLayout_t> faraday;
+    Ampere<GridLayout_t> ampere;
+    Ohm<GridLayout_t> ohm;
+    FusedFieldSolver<GridLayout_t> fused;
+};
+
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void faraday(benchmark::State& state)
+{
+    FieldSolversBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.faraday(bench.B.vecfield, bench.E.vecfield, bench.Bnew.vecfield);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void ampere(benchmark::State& state)
+{
+    FieldSolversBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.ampere(bench.B.vecfield, bench.J.vecfield);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void ohm(benchmark::State& state)
+{
+    FieldSolversBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.ohm(bench.n, bench.Ve.vecfield, bench.Pe, bench.B.vecfield, bench.J.vecfield,
+                  bench.Enew.vecfield);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+// ampere, ohm and faraday in turn, each sweeping the whole patch
+template<std::size_t dim, std::size_t interpOrder>
+void separateSolvers(benchmark::State& state)
+{
+    FieldSolversBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.ampere(bench.B.vecfield, bench.J.vecfield);
+        bench.ohm(bench.n, bench.Ve.vecfield, bench.Pe, bench.B.vecfield, bench.J.vecfield,
+                  bench.E.vecfield);
+        bench.faraday(bench.B.vecfield, bench.E.vecfield, bench.Bnew.vecfield);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+// the same three solvers in a single sweep of the patch
+template<std::size_t dim, std::size_t interpOrder>
+void fusedSolvers(benchmark::State& state)
+{
+    FieldSolversBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.fused(bench.B.vecfield, bench.n, bench.Ve.vecfield, bench.Pe, bench.J.vecfield,
+                    bench.E.vecfield, bench.Bnew.vecfield);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench.nbrCells());
+}
+
+
+
+// items per second is the number of cells updated per second
+#define PHARE_FIELD_SOLVERS_BENCH(dim, order)                                                     \
+    BENCHMARK_TEMPLATE(faraday, dim, order)->Apply(patchArguments<dim>);                          \
+    BENCHMARK_TEMPLATE(ampere, dim, order)->Apply(patchArguments<dim>);                           \
+    BENCHMARK_TEMPLATE(ohm, dim, order)->Apply(patchArguments<dim>);                              \
+    BENCHMARK_TEMPLATE(separateSolvers, dim, order)->Apply(patchArguments<dim>);                  \
+    BENCHMARK_TEMPLATE(fusedSolvers, dim, order)->Apply(patchArguments<dim>)
+
+PHARE_FIELD_SOLVERS_BENCH(1, 1);
+PHARE_FIELD_SOLVERS_BENCH(1, 2);
+PHARE_FIELD_SOLVERS_BENCH(1, 3);
+PHARE_FIELD_SOLVERS_BENCH(2, 1);
+PHARE_FIELD_SOLVERS_BENCH(2, 2);
+PHARE_FIELD_SOLVERS_BENCH(2, 3);
+PHARE_FIELD_SOLVERS_BENCH(3, 1);
+PHARE_FIELD_SOLVERS_BENCH(3, 2);
+PHARE_FIELD_SOLVERS_BENCH(3, 3);
+
+
+
+BENCHMARK_MAIN();
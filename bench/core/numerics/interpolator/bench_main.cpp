@@ -0,0 +1,120 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "bench_utilities.h"
+
+#include "data/electromag/electromag.h"
+#include "data/field/field.h"
+#include "data/grid/gridlayout.h"
+#include "data/grid/gridlayout_impl.h"
+#include "data/particles/particle_array.h"
+#include "data/vecfield/vecfield.h"
+#include "hybrid/hybrid_quantities.h"
+#include "numerics/interpolator/interpolator.h"
+
+using namespace PHARE::core;
+using namespace PHARE::bench;
+
+
+
+// a patch of nbrCells^dim cells with particlesPerCell particles per cell, uniformly
+// distributed, and uniform electromagnetic fields.
+template<std::size_t dim, std::size_t interpOrder>
+struct InterpolatorBench
+{
+    using Field_t    = Field<NdArray<dim>, HybridQuantity::Scalar>;
+    using VecField_t = VecField<NdArray<dim>, HybridQuantity>;
+
+    InterpolatorBench(std::uint32_t nbrCells, std::size_t particlesPerCell)
+        : layout{filled<dim>(0.1), filled<dim>(nbrCells), Point<double, dim>{}}
+        , particles{uniformParticles<dim>(nbrCells, particlesPerCell)}
+    {
+        em.E.setBuffer("EM_E_x", &ex);
+        em.E.setBuffer("EM_E_y", &ey);
+        em.E.setBuffer("EM_E_z", &ez);
+        em.B.setBuffer("EM_B_x", &bx);
+        em.B.setBuffer("EM_B_y", &by);
+        em.B.setBuffer("EM_B_z", &bz);
+
+        v.setBuffer("v_x", &vx);
+        v.setBuffer("v_y", &vy);
+        v.setBuffer("v_z", &vz);
+    }
+
+    GridLayout<GridLayoutImplYee<dim, interpOrder>> layout;
+
+    Field_t ex{"EM_E_x", HybridQuantity::Scalar::Ex, layout.allocSize(HybridQuantity::Scalar::Ex)};
+    Field_t ey{"EM_E_y", HybridQuantity::Scalar::Ey, layout.allocSize(HybridQuantity::Scalar::Ey)};
+    Field_t ez{"EM_E_z", HybridQuantity::Scalar::Ez, layout.allocSize(HybridQuantity::Scalar::Ez)};
+    Field_t bx{"EM_B_x", HybridQuantity::Scalar::Bx, layout.allocSize(HybridQuantity::Scalar::Bx)};
+    Field_t by{"EM_B_y", HybridQuantity::Scalar::By, layout.allocSize(HybridQuantity::Scalar::By)};
+    Field_t bz{"EM_B_z", HybridQuantity::Scalar::Bz, layout.allocSize(HybridQuantity::Scalar::Bz)};
+    Electromag<VecField_t> em{"EM"};
+
+    Field_t rho{"rho", HybridQuantity::Scalar::rho, layout.allocSize(HybridQuantity::Scalar::rho)};
+    Field_t vx{"v_x", HybridQuantity::Scalar::Vx, layout.allocSize(HybridQuantity::Scalar::Vx)};
+    Field_t vy{"v_y", HybridQuantity::Scalar::Vy, layout.allocSize(HybridQuantity::Scalar::Vy)};
+    Field_t vz{"v_z", HybridQuantity::Scalar::Vz, layout.allocSize(HybridQuantity::Scalar::Vz)};
+    VecField_t v{"v", HybridQuantity::Vector::V};
+
+    ParticleArray<dim> particles;
+    Interpolator<dim, interpOrder> interpolator;
+};
+
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void interpolateFields(benchmark::State& state)
+{
+    InterpolatorBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0)),
+                                              static_cast<std::size_t>(state.range(1))};
+    auto& particles = bench.particles;
+
+    for (auto _ : state)
+    {
+        bench.interpolator(std::begin(particles), std::end(particles), bench.em, bench.layout);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(particles.size()));
+}
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+void depositMoments(benchmark::State& state)
+{
+    InterpolatorBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0)),
+                                              static_cast<std::size_t>(state.range(1))};
+    auto& particles = bench.particles;
+
+    for (auto _ : state)
+    {
+        bench.interpolator(std::begin(particles), std::end(particles), bench.rho, bench.v,
+                           bench.layout);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(particles.size()));
+}
+
+
+
+// items per second is the number of particles processed per second
+#define PHARE_INTERPOLATOR_BENCH(dim, order)                                                      \
+    BENCHMARK_TEMPLATE(interpolateFields, dim, order)->Apply(particleArguments<dim>);             \
+    BENCHMARK_TEMPLATE(depositMoments, dim, order)->Apply(particleArguments<dim>)
+
+PHARE_INTERPOLATOR_BENCH(1, 1);
+PHARE_INTERPOLATOR_BENCH(1, 2);
+PHARE_INTERPOLATOR_BENCH(1, 3);
+PHARE_INTERPOLATOR_BENCH(2, 1);
+PHARE_INTERPOLATOR_BENCH(2, 2);
+PHARE_INTERPOLATOR_BENCH(2, 3);
+PHARE_INTERPOLATOR_BENCH(3, 1);
+PHARE_INTERPOLATOR_BENCH(3, 2);
+PHARE_INTERPOLATOR_BENCH(3, 3);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,135 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "bench_utilities.h"
+
+#include "data/electromag/electromag.h"
+#include "data/field/field.h"
+#include "data/grid/gridlayout.h"
+#include "data/grid/gridlayout_impl.h"
+#include "data/particles/particle_array.h"
+#include "data/vecfield/vecfield.h"
+#include "hybrid/hybrid_quantities.h"
+#include "numerics/boundary_condition/boundary_condition.h"
+#include "numerics/interpolator/interpolator.h"
+#include "numerics/pusher/boris.h"
+#include "utilities/box/box.h"
+#include "utilities/particle_selector/particle_selector.h"
+#include "utilities/range/range.h"
+
+using namespace PHARE::core;
+using namespace PHARE::bench;
+
+
+
+// the pusher calls the interpolator without the layout, this binds it to the patch layout
+template<typename InterpolatorT, typename GridLayoutT>
+struct LayoutInterpolator
+{
+    template<typename PartIterator, typename Electromag>
+    void operator()(PartIterator begin, PartIterator end, Electromag const& em)
+    {
+        interpolator(begin, end, em, *layout);
+    }
+
+    InterpolatorT interpolator;
+    GridLayoutT const* layout;
+};
+
+
+
+
+template<std::size_t dim, std::size_t interpOrder>
+struct PusherBench
+{
+    using Field_t      = Field<NdArray<dim>, HybridQuantity::Scalar>;
+    using VecField_t   = VecField<NdArray<dim>, HybridQuantity>;
+    using GridLayout_t = GridLayout<GridLayoutImplYee<dim, interpOrder>>;
+    using Electromag_t = Electromag<VecField_t>;
+    using Interpolator_t = LayoutInterpolator<Interpolator<dim, interpOrder>, GridLayout_t>;
+    using Selector_t     = ParticleSelector<std::vector<Box<int, dim>>>;
+    using Pusher_t = BorisPusher<dim, typename ParticleArray<dim>::iterator, Electromag_t,
+                                 Interpolator_t, Selector_t, BoundaryCondition<dim, interpOrder>>;
+
+    PusherBench(std::uint32_t nbrCells, std::size_t particlesPerCell)
+        : layout{filled<dim>(0.1), filled<dim>(nbrCells), Point<double, dim>{}}
+        , particlesIn{uniformParticles<dim>(nbrCells, particlesPerCell)}
+        , particlesOut(particlesIn.size())
+        , isInPatch{std::vector<Box<int, dim>>{
+              Box<int, dim>{Point<int, dim>{}, Point<int, dim>{filled<dim>(int(nbrCells))}}}}
+    {
+        em.E.setBuffer("EM_E_x", &ex);
+        em.E.setBuffer("EM_E_y", &ey);
+        em.E.setBuffer("EM_E_z", &ez);
+        em.B.setBuffer("EM_B_x", &bx);
+        em.B.setBuffer("EM_B_y", &by);
+        em.B.setBuffer("EM_B_z", &bz);
+
+        interpolator.layout = &layout;
+        pusher.setMeshAndTimeStep(filled<dim>(0.1), 0.001);
+    }
+
+    GridLayout_t layout;
+
+    Field_t ex{"EM_E_x", HybridQuantity::Scalar::Ex, layout.allocSize(HybridQuantity::Scalar::Ex)};
+    Field_t ey{"EM_E_y", HybridQuantity::Scalar::Ey, layout.allocSize(HybridQuantity::Scalar::Ey)};
+    Field_t ez{"EM_E_z", HybridQuantity::Scalar::Ez, layout.allocSize(HybridQuantity::Scalar::Ez)};
+    Field_t bx{"EM_B_x", HybridQuantity::Scalar::Bx, layout.allocSize(HybridQuantity::Scalar::Bx)};
+    Field_t by{"EM_B_y", HybridQuantity::Scalar::By, layout.allocSize(HybridQuantity::Scalar::By)};
+    Field_t bz{"EM_B_z", HybridQuantity::Scalar::Bz, layout.allocSize(HybridQuantity::Scalar::Bz)};
+    Electromag_t em{"EM"};
+
+    ParticleArray<dim> particlesIn;
+    ParticleArray<dim> particlesOut;
+
+    Selector_t isInPatch;
+    Interpolator_t interpolator;
+    Pusher_t pusher;
+};
+
+
+
+
+// each iteration pushes the same particles, leaving ones are only moved to the end of
+// particlesOut as they would be before being sent to the neighbour patches
+template<std::size_t dim, std::size_t interpOrder>
+void borisMove(benchmark::State& state)
+{
+    PusherBench<dim, interpOrder> bench{static_cast<std::uint32_t>(state.range(0)),
+                                        static_cast<std::size_t>(state.range(1))};
+
+    auto rangeIn = makeRange(std::begin(bench.particlesIn), std::end(bench.particlesIn));
+    double mass  = 1.;
+
+    for (auto _ : state)
+    {
+        auto rangeOut = makeRange(std::begin(bench.particlesOut), std::end(bench.particlesOut));
+        benchmark::DoNotOptimize(bench.pusher.move(rangeIn, rangeOut, bench.em, mass,
+                                                   bench.interpolator, bench.isInPatch));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations()
+                            * static_cast<std::int64_t>(bench.particlesIn.size()));
+}
+
+
+
+// items per second is the number of particles pushed per second
+#define PHARE_PUSHER_BENCH(dim, order)                                                            \
+    BENCHMARK_TEMPLATE(borisMove, dim, order)->Apply(particleArguments<dim>)
+
+PHARE_PUSHER_BENCH(1, 1);
+PHARE_PUSHER_BENCH(1, 2);
+PHARE_PUSHER_BENCH(1, 3);
+PHARE_PUSHER_BENCH(2, 1);
+PHARE_PUSHER_BENCH(2, 2);
+PHARE_PUSHER_BENCH(2, 3);
+PHARE_PUSHER_BENCH(3, 1);
+PHARE_PUSHER_BENCH(3, 2);
+PHARE_PUSHER_BENCH(3, 3);
+
+
+
+BENCHMARK_MAIN();
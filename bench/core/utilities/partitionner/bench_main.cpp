@@ -0,0 +1,65 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "bench_utilities.h"
+
+#include "data/particles/particle_array.h"
+#include "utilities/box/box.h"
+#include "utilities/partitionner/partitionner.h"
+#include "utilities/point/point.h"
+
+using namespace PHARE::core;
+using namespace PHARE::bench;
+
+
+
+// particles are uniformly distributed on the patch grown by one cell on each side, and are
+// partitioned according to the two boxes of the ghost cells at the lower and upper x
+// boundaries, like leaving particles would be after the push.
+template<std::size_t dim>
+void partitionLeavingParticles(benchmark::State& state)
+{
+    auto nbrCells = static_cast<std::uint32_t>(state.range(0));
+    auto original = uniformParticles<dim>(nbrCells + 2, static_cast<std::size_t>(state.range(1)));
+    for (auto& particle : original)
+    {
+        for (auto& iCell : particle.iCell)
+            iCell -= 1;
+    }
+
+    auto lower = Point<int, dim>{filled<dim>(-1)};
+    auto upper = Point<int, dim>{filled<dim>(static_cast<int>(nbrCells) + 1)};
+
+    auto lowerXUpper = upper;
+    lowerXUpper[0]   = 0;
+    auto upperXLower = lower;
+    upperXLower[0]   = static_cast<int>(nbrCells);
+
+    std::vector<Box<int, dim>> boundaryBoxes{Box<int, dim>{lower, lowerXUpper},
+                                             Box<int, dim>{upperXLower, upper}};
+
+    ParticleArray<dim> particles;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        particles = original;
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(
+            partitionner(std::begin(particles), std::end(particles), boundaryBoxes));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(original.size()));
+}
+
+
+
+// items per second is the number of particles partitionned per second
+BENCHMARK_TEMPLATE(partitionLeavingParticles, 1)->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(partitionLeavingParticles, 2)->Apply(particleArguments<2>);
+BENCHMARK_TEMPLATE(partitionLeavingParticles, 3)->Apply(particleArguments<3>);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,311 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <SAMRAI/geom/CartesianPatchGeometry.h>
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+#include <SAMRAI/tbox/MessageStream.h>
+#include <SAMRAI/tbox/SAMRAIManager.h>
+#include <SAMRAI/tbox/SAMRAI_MPI.h>
+
+#include "bench_utilities.h"
+
+#include "data/field/field.h"
+#include "data/field/field_data.h"
+#include "data/field/field_overlap.h"
+#include "data/field/field_variable.h"
+#include "data/grid/gridlayout.h"
+#include "data/grid/gridlayout_impl.h"
+#include "hybrid/hybrid_quantities.h"
+
+using namespace PHARE::core;
+using namespace PHARE::amr_interface;
+using namespace PHARE::bench;
+
+
+
+// two 1D patches of nbrCells cells, the destination being shifted by half a patch, with an
+// Ex FieldData allocated on each. FieldData is only exercised in 1D, like in its tests.
+template<std::size_t interpOrder>
+struct FieldDataBench
+{
+    using GridLayout_t = GridLayout<GridLayoutImplYee<1, interpOrder>>;
+    using Field_t      = Field<NdArrayVector1D<>, HybridQuantity::Scalar>;
+    using FieldData_t  = FieldData<GridLayout_t, Field_t>;
+
+
+    struct Patch1D
+    {
+        Patch1D(SAMRAI::tbox::Dimension const& dimension, int lowerCell, int nbrCells, double dx)
+            : lower{dx * lowerCell}
+            , upper{dx * (lowerCell + nbrCells)}
+            , touchesRegular{dimension, false}
+            , patch{SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, lowerCell},
+                                      SAMRAI::hier::Index{dimension, lowerCell + nbrCells - 1},
+                                      SAMRAI::hier::BlockId{0}},
+                    std::make_shared<SAMRAI::hier::PatchDescriptor>()}
+        {
+            patch.setPatchGeometry(std::make_shared<SAMRAI::geom::CartesianPatchGeometry>(
+                SAMRAI::hier::IntVector::getOne(dimension), touchesRegular,
+                SAMRAI::hier::BlockId{0}, &dx, &lower, &upper));
+        }
+
+        double lower;
+        double upper;
+        SAMRAI::hier::PatchGeometry::TwoDimBool touchesRegular;
+        SAMRAI::hier::Patch patch;
+    };
+
+
+    explicit FieldDataBench(int nbrCells)
+        : source{dimension, 0, nbrCells, dx}
+        , destination{dimension, nbrCells / 2, nbrCells, dx}
+        , factory{variable.getPatchDataFactory()}
+        , sourceGeometry{factory->getBoxGeometry(source.patch.getBox())}
+        , destinationGeometry{factory->getBoxGeometry(destination.patch.getBox())}
+        , sourceData{std::dynamic_pointer_cast<FieldData_t>(factory->allocate(source.patch))}
+        , destinationData{
+              std::dynamic_pointer_cast<FieldData_t>(factory->allocate(destination.patch))}
+        , overlap{std::dynamic_pointer_cast<FieldOverlap<1>>(
+              destinationGeometry->calculateOverlap(
+                  *sourceGeometry, sourceData->getGhostBox(), destinationData->getGhostBox(), true,
+                  SAMRAI::hier::Transformation{SAMRAI::hier::IntVector::getZero(dimension)}))}
+    {
+        for (auto& value : sourceData->field)
+            value = 1.;
+    }
+
+
+    SAMRAI::tbox::Dimension dimension{1};
+    double dx{0.01};
+
+    Patch1D source;
+    Patch1D destination;
+
+    FieldVariable<GridLayout_t, Field_t> variable{"Ex", HybridQuantity::Scalar::Ex};
+    std::shared_ptr<SAMRAI::hier::PatchDataFactory> factory;
+
+    std::shared_ptr<SAMRAI::hier::BoxGeometry> sourceGeometry;
+    std::shared_ptr<SAMRAI::hier::BoxGeometry> destinationGeometry;
+
+    std::shared_ptr<FieldData_t> sourceData;
+    std::shared_ptr<FieldData_t> destinationData;
+
+    std::shared_ptr<FieldOverlap<1>> overlap;
+};
+
+
+
+
+template<std::size_t interpOrder>
+void packStream(benchmark::State& state)
+{
+    FieldDataBench<interpOrder> bench{static_cast<int>(state.range(0))};
+
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        SAMRAI::tbox::MessageStream stream;
+        bench.sourceData->packStream(stream, *bench.overlap);
+        bytes = stream.getCurrentSize();
+        benchmark::DoNotOptimize(stream.getBufferStart());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+
+
+template<std::size_t interpOrder>
+void copy(benchmark::State& state)
+{
+    FieldDataBench<interpOrder> bench{static_cast<int>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        bench.destinationData->copy(*bench.sourceData, *bench.overlap);
+        benchmark::ClobberMemory();
+    }
+}
+
+
+
+
+// FieldDataInternals of a field of a patch of nbrCells cells per direction, with ghostWidth
+// ghost nodes on each side, and the 2 * dim slabs of ghostWidth nodes along its faces, which
+// are what a patch exchanges with its face neighbours. FieldData itself is only 1D, its internals
+// are benchmarked in 2D and 3D where the contiguous rows are shorter than the overlaps.
+template<std::size_t dim>
+struct GhostSlabsBench
+{
+    using GridLayout_t = GridLayout<GridLayoutImplYee<dim, 1>>;
+    using Field_t      = Field<NdArray<dim>, HybridQuantity::Scalar>;
+    using Internals_t  = FieldDataInternals<GridLayout_t, dim, Field_t, HybridQuantity::Scalar>;
+
+
+    GhostSlabsBench(int nbrCells, int ghostWidth)
+        : nbrNodes{nbrCells + 1 + 2 * ghostWidth}
+        , source{"source", HybridQuantity::Scalar::rho,
+                 filled<dim>(static_cast<std::uint32_t>(nbrNodes))}
+        , destination{"destination", HybridQuantity::Scalar::rho,
+                      filled<dim>(static_cast<std::uint32_t>(nbrNodes))}
+        , fieldBox{box_(filled<dim>(0), filled<dim>(nbrNodes - 1))}
+    {
+        for (std::size_t iDir = 0; iDir < dim; ++iDir)
+        {
+            auto lower = filled<dim>(0);
+            auto upper = filled<dim>(nbrNodes - 1);
+
+            upper[iDir] = ghostWidth - 1;
+            slabs.push_back(box_(lower, upper));
+
+            lower[iDir] = nbrNodes - ghostWidth;
+            upper[iDir] = nbrNodes - 1;
+            slabs.push_back(box_(lower, upper));
+        }
+
+        for (auto& value : source)
+            value = 1.;
+    }
+
+
+    std::size_t bytes() const
+    {
+        std::size_t nbrValues = 0;
+        for (auto const& slab : slabs)
+            nbrValues += static_cast<std::size_t>(slab.size());
+        return nbrValues * sizeof(double);
+    }
+
+
+    SAMRAI::tbox::Dimension dimension{dim};
+    int nbrNodes;
+    Field_t source;
+    Field_t destination;
+    SAMRAI::hier::Box fieldBox;
+    std::vector<SAMRAI::hier::Box> slabs;
+    Internals_t internals;
+
+private:
+    SAMRAI::hier::Box box_(std::array<int, dim> const& lower, std::array<int, dim> const& upper)
+    {
+        SAMRAI::hier::Index lowerIndex{dimension, 0};
+        SAMRAI::hier::Index upperIndex{dimension, 0};
+        for (std::size_t iDir = 0; iDir < dim; ++iDir)
+        {
+            lowerIndex[iDir] = lower[iDir];
+            upperIndex[iDir] = upper[iDir];
+        }
+        return SAMRAI::hier::Box{lowerIndex, upperIndex, SAMRAI::hier::BlockId{0}};
+    }
+};
+
+
+
+template<std::size_t dim>
+void packGhostSlabs(benchmark::State& state)
+{
+    GhostSlabsBench<dim> bench{static_cast<int>(state.range(0)), static_cast<int>(state.range(1))};
+
+    // streams are sized from getDataStreamSize() before being packed
+    for (auto _ : state)
+    {
+        SAMRAI::tbox::MessageStream stream{bench.bytes(), SAMRAI::tbox::MessageStream::Write};
+        for (auto const& slab : bench.slabs)
+            bench.internals.packImpl(stream, bench.source, slab, bench.fieldBox);
+        benchmark::DoNotOptimize(stream.getBufferStart());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bench.bytes()));
+}
+
+
+
+template<std::size_t dim>
+void unpackGhostSlabs(benchmark::State& state)
+{
+    GhostSlabsBench<dim> bench{static_cast<int>(state.range(0)), static_cast<int>(state.range(1))};
+
+    SAMRAI::tbox::MessageStream packed;
+    for (auto const& slab : bench.slabs)
+        bench.internals.packImpl(packed, bench.source, slab, bench.fieldBox);
+
+    for (auto _ : state)
+    {
+        SAMRAI::tbox::MessageStream stream{packed.getCurrentSize(),
+                                           SAMRAI::tbox::MessageStream::Read,
+                                           packed.getBufferStart(), false};
+        for (auto const& slab : bench.slabs)
+            bench.internals.unpackImpl(stream, bench.destination, slab, bench.fieldBox);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bench.bytes()));
+}
+
+
+
+template<std::size_t dim>
+void copyGhostSlabs(benchmark::State& state)
+{
+    GhostSlabsBench<dim> bench{static_cast<int>(state.range(0)), static_cast<int>(state.range(1))};
+
+    for (auto _ : state)
+    {
+        for (auto const& slab : bench.slabs)
+            bench.internals.copyImpl(slab, bench.source, slab, bench.destination);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bench.bytes()));
+}
+
+
+
+//! benchmark arguments: the number of cells per direction of the patch and of ghost nodes
+template<std::size_t dim>
+void ghostSlabsArguments(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"cells", "ghosts"});
+    for (auto cells : patchSizes<dim>())
+        for (auto ghosts : {2, 5})
+            bench->Args({cells, ghosts});
+}
+
+
+
+
+BENCHMARK_TEMPLATE(packStream, 1)->Apply(patchArguments<1>);
+BENCHMARK_TEMPLATE(packStream, 2)->Apply(patchArguments<1>);
+BENCHMARK_TEMPLATE(packStream, 3)->Apply(patchArguments<1>);
+
+BENCHMARK_TEMPLATE(copy, 1)->Apply(patchArguments<1>);
+BENCHMARK_TEMPLATE(copy, 2)->Apply(patchArguments<1>);
+BENCHMARK_TEMPLATE(copy, 3)->Apply(patchArguments<1>);
+
+BENCHMARK_TEMPLATE(packGhostSlabs, 2)->Apply(ghostSlabsArguments<2>);
+BENCHMARK_TEMPLATE(packGhostSlabs, 3)->Apply(ghostSlabsArguments<3>);
+
+BENCHMARK_TEMPLATE(unpackGhostSlabs, 2)->Apply(ghostSlabsArguments<2>);
+BENCHMARK_TEMPLATE(unpackGhostSlabs, 3)->Apply(ghostSlabsArguments<3>);
+
+BENCHMARK_TEMPLATE(copyGhostSlabs, 2)->Apply(ghostSlabsArguments<2>);
+BENCHMARK_TEMPLATE(copyGhostSlabs, 3)->Apply(ghostSlabsArguments<3>);
+
+
+
+
+int main(int argc, char** argv)
+{
+    SAMRAI::tbox::SAMRAI_MPI::init(&argc, &argv);
+    SAMRAI::tbox::SAMRAIManager::initialize();
+    SAMRAI::tbox::SAMRAIManager::startup();
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    SAMRAI::tbox::SAMRAIManager::shutdown();
+    SAMRAI::tbox::SAMRAIManager::finalize();
+    SAMRAI::tbox::SAMRAI_MPI::finalize();
+
+    return 0;
+}
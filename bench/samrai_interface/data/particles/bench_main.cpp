@@ -0,0 +1,200 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+#include <SAMRAI/pdat/CellGeometry.h>
+#include <SAMRAI/pdat/CellOverlap.h>
+#include <SAMRAI/tbox/MessageStream.h>
+#include <SAMRAI/tbox/SAMRAIManager.h>
+#include <SAMRAI/tbox/SAMRAI_MPI.h>
+
+#include "bench_utilities.h"
+
+#include "data/particles/particles_data.h"
+
+using namespace PHARE::core;
+using namespace PHARE::amr_interface;
+using namespace PHARE::bench;
+
+
+
+// a source patch [0, nbrCells[^dim filled with particles, and a destination patch shifted by
+// destinationShift cells. By default it is half a patch in each direction, so that the overlap
+// of the destination ghost box with the source covers about half of the source particles.
+template<std::size_t dim>
+struct ParticlesDataBench
+{
+    static SAMRAI::hier::Box makeBox(SAMRAI::tbox::Dimension const& dimension, int lower,
+                                     int upper)
+    {
+        return SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, lower},
+                                 SAMRAI::hier::Index{dimension, upper},
+                                 SAMRAI::hier::BlockId{0}};
+    }
+
+    static SAMRAI::hier::Box shifted(SAMRAI::hier::Box box, SAMRAI::hier::IntVector const& shift)
+    {
+        box.shift(shift);
+        return box;
+    }
+
+
+    ParticlesDataBench(int nbrCells, std::size_t particlesPerCell)
+        : ParticlesDataBench(
+            nbrCells, particlesPerCell,
+            SAMRAI::hier::IntVector{SAMRAI::tbox::Dimension{dim}, nbrCells / 2})
+    {
+    }
+
+
+    ParticlesDataBench(int nbrCells, std::size_t particlesPerCell,
+                       SAMRAI::hier::IntVector const& destinationShift)
+        : sourceDomain{makeBox(dimension, 0, nbrCells - 1)}
+        , destDomain{shifted(sourceDomain, destinationShift)}
+        , sourceData{sourceDomain, ghost}
+        , destData{destDomain, ghost}
+        , sourceGeom{std::make_shared<SAMRAI::pdat::CellGeometry>(sourceDomain, ghost)}
+        , destGeom{std::make_shared<SAMRAI::pdat::CellGeometry>(destDomain, ghost)}
+        , overlap{std::dynamic_pointer_cast<SAMRAI::pdat::CellOverlap>(destGeom->calculateOverlap(
+              *sourceGeom, sourceData.getGhostBox(), destData.getGhostBox(), true,
+              SAMRAI::hier::Transformation{SAMRAI::hier::IntVector::getZero(dimension)}))}
+    {
+        sourceData.domainParticles
+            = uniformParticles<dim>(static_cast<std::uint32_t>(nbrCells), particlesPerCell);
+    }
+
+
+    SAMRAI::tbox::Dimension dimension{static_cast<unsigned short>(dim)};
+    SAMRAI::hier::IntVector ghost{SAMRAI::hier::IntVector::getOne(dimension)};
+
+    SAMRAI::hier::Box sourceDomain;
+    SAMRAI::hier::Box destDomain;
+
+    ParticlesData<dim> sourceData;
+    ParticlesData<dim> destData;
+
+    std::shared_ptr<SAMRAI::hier::BoxGeometry> sourceGeom;
+    std::shared_ptr<SAMRAI::hier::BoxGeometry> destGeom;
+
+    std::shared_ptr<SAMRAI::pdat::CellOverlap> overlap;
+};
+
+
+
+
+template<std::size_t dim>
+void packStream(benchmark::State& state)
+{
+    ParticlesDataBench<dim> bench{static_cast<int>(state.range(0)),
+                                  static_cast<std::size_t>(state.range(1))};
+
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        SAMRAI::tbox::MessageStream stream;
+        bench.sourceData.packStream(stream, *bench.overlap);
+        bytes = stream.getCurrentSize();
+        benchmark::DoNotOptimize(stream.getBufferStart());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+
+
+template<std::size_t dim>
+void packUnpackStream(benchmark::State& state)
+{
+    ParticlesDataBench<dim> bench{static_cast<int>(state.range(0)),
+                                  static_cast<std::size_t>(state.range(1))};
+
+    for (auto _ : state)
+    {
+        SAMRAI::tbox::MessageStream writeStream;
+        bench.sourceData.packStream(writeStream, *bench.overlap);
+
+        SAMRAI::tbox::MessageStream readStream{writeStream.getCurrentSize(),
+                                               SAMRAI::tbox::MessageStream::Read,
+                                               writeStream.getBufferStart()};
+        bench.destData.unpackStream(readStream, *bench.overlap);
+
+        state.PauseTiming();
+        bench.destData.domainParticles.clear();
+        bench.destData.patchGhostParticles.clear();
+        state.ResumeTiming();
+    }
+}
+
+
+
+
+// a ghost exchange between two neighbour patches, the destination starting in x where the
+// source ends: only the particles of the last column of source cells are sent. The particles are marked as
+// changed at each iteration, as they are by the pusher between two exchanges, so that the
+// border index of the source is built again each time.
+void neighbourExchange2D(benchmark::State& state)
+{
+    auto const nbrCells = static_cast<int>(state.range(0));
+
+    SAMRAI::hier::IntVector shift{SAMRAI::tbox::Dimension{2}, 0};
+    shift[0] = nbrCells;
+    ParticlesDataBench<2> bench{nbrCells, static_cast<std::size_t>(state.range(1)), shift};
+
+    std::size_t bytesPacked = 0;
+    bench.sourceData.resetStreamCounters();
+    for (auto _ : state)
+    {
+        bench.sourceData.particlesChanged();
+
+        SAMRAI::tbox::MessageStream stream{bench.sourceData.getDataStreamSize(*bench.overlap),
+                                           SAMRAI::tbox::MessageStream::Write};
+        bench.sourceData.packStream(stream, *bench.overlap);
+        benchmark::DoNotOptimize(stream.getBufferStart());
+        bytesPacked = stream.getCurrentSize();
+    }
+    auto const& counters          = bench.sourceData.streamCounters();
+    auto const nbrExchanges       = static_cast<double>(state.iterations());
+    state.counters["bytesPacked"] = static_cast<double>(bytesPacked);
+    state.counters["scanned"]     = static_cast<double>(counters.scanned) / nbrExchanges;
+    state.counters["sent"]        = static_cast<double>(counters.sent) / nbrExchanges;
+    state.SetItemsProcessed(state.iterations()
+                            * static_cast<std::int64_t>(bench.sourceData.domainParticles.size()));
+}
+
+
+
+
+BENCHMARK(neighbourExchange2D)
+    ->Args({32, 100})
+    ->Args({64, 100})
+    ->Args({64, 200})
+    ->Args({128, 100})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(packStream, 1)->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(packStream, 2)->Apply(particleArguments<2>);
+BENCHMARK_TEMPLATE(packStream, 3)->Apply(particleArguments<3>);
+
+BENCHMARK_TEMPLATE(packUnpackStream, 1)->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(packUnpackStream, 2)->Apply(particleArguments<2>);
+BENCHMARK_TEMPLATE(packUnpackStream, 3)->Apply(particleArguments<3>);
+
+
+
+
+int main(int argc, char** argv)
+{
+    SAMRAI::tbox::SAMRAI_MPI::init(&argc, &argv);
+    SAMRAI::tbox::SAMRAIManager::initialize();
+    SAMRAI::tbox::SAMRAIManager::startup();
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    SAMRAI::tbox::SAMRAIManager::shutdown();
+    SAMRAI::tbox::SAMRAIManager::finalize();
+    SAMRAI::tbox::SAMRAI_MPI::finalize();
+
+    return 0;
+}
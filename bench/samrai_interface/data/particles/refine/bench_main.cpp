@@ -0,0 +1,211 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <SAMRAI/geom/CartesianPatchGeometry.h>
+#include <SAMRAI/hier/BoxContainer.h>
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+#include <SAMRAI/pdat/CellOverlap.h>
+#include <SAMRAI/tbox/SAMRAIManager.h>
+#include <SAMRAI/tbox/SAMRAI_MPI.h>
+
+#include "bench_utilities.h"
+
+#include "data/particles/particles_data.h"
+#include "data/particles/particles_data_factory.h"
+#include "data/particles/refine/particles_data_split.h"
+#include "data/particles/refine/split.h"
+
+using namespace PHARE::core;
+using namespace PHARE::amr_interface;
+using namespace PHARE::bench;
+
+
+
+// a 1D coarse patch of nbrCells cells filled with particles, and the fine patch covering it
+// with a refinement ratio of 2, the only one the split is tabulated for
+template<std::size_t interpOrder>
+struct ParticlesRefineBench
+{
+    static constexpr int ratio = 2;
+
+    struct Patch1D
+    {
+        Patch1D(SAMRAI::tbox::Dimension const& dimension, int nbrCells, double dx,
+                std::shared_ptr<SAMRAI::hier::PatchDescriptor> descriptor, int dataId)
+            : upper{dx * nbrCells}
+            , touchesRegular{dimension, false}
+            , patch{SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, 0},
+                                      SAMRAI::hier::Index{dimension, nbrCells - 1},
+                                      SAMRAI::hier::BlockId{0}},
+                    descriptor}
+        {
+            patch.setPatchGeometry(std::make_shared<SAMRAI::geom::CartesianPatchGeometry>(
+                SAMRAI::hier::IntVector::getOne(dimension), touchesRegular,
+                SAMRAI::hier::BlockId{0}, &dx, &lower, &upper));
+            patch.allocatePatchData(dataId);
+        }
+
+        ParticlesData<1>& particles(int dataId)
+        {
+            return *std::dynamic_pointer_cast<ParticlesData<1>>(patch.getPatchData(dataId));
+        }
+
+        double lower{0.};
+        double upper;
+        SAMRAI::hier::PatchGeometry::TwoDimBool touchesRegular;
+        SAMRAI::hier::Patch patch;
+    };
+
+
+    ParticlesRefineBench(int nbrCells, std::size_t particlesPerCell)
+        : dataId{descriptor->definePatchDataComponent(
+              "protons", std::make_shared<ParticlesDataFactory<1>>(
+                             SAMRAI::hier::IntVector{dimension, ghostWidth}, false))}
+        , coarse{dimension, nbrCells, 0.1, descriptor, dataId}
+        , fine{dimension, ratio * nbrCells, 0.1 / ratio, descriptor, dataId}
+    {
+        coarse.particles(dataId).domainParticles
+            = uniformParticles<1>(static_cast<std::uint32_t>(nbrCells), particlesPerCell);
+    }
+
+
+    //! the overlap used to fill the fine patch interior
+    SAMRAI::pdat::CellOverlap interiorOverlap() const
+    {
+        return SAMRAI::pdat::CellOverlap{SAMRAI::hier::BoxContainer{fine.patch.getBox()},
+                                         SAMRAI::hier::Transformation{zero()}};
+    }
+
+
+    //! the overlap used to fill the fine patch ghost layers from the coarse patch
+    SAMRAI::pdat::CellOverlap coarseBoundaryOverlap() const
+    {
+        auto const& box = fine.patch.getBox();
+
+        SAMRAI::hier::BoxContainer ghostLayers;
+        ghostLayers.pushBack(SAMRAI::hier::Box{
+            SAMRAI::hier::Index{dimension, box.lower()[0] - ghostWidth},
+            SAMRAI::hier::Index{dimension, box.lower()[0] - 1}, SAMRAI::hier::BlockId{0}});
+        ghostLayers.pushBack(SAMRAI::hier::Box{
+            SAMRAI::hier::Index{dimension, box.upper()[0] + 1},
+            SAMRAI::hier::Index{dimension, box.upper()[0] + ghostWidth}, SAMRAI::hier::BlockId{0}});
+
+        return SAMRAI::pdat::CellOverlap{ghostLayers, SAMRAI::hier::Transformation{zero()}};
+    }
+
+
+    SAMRAI::hier::IntVector zero() const { return SAMRAI::hier::IntVector::getZero(dimension); }
+
+
+    SAMRAI::tbox::Dimension dimension{1};
+    int ghostWidth{static_cast<int>(ghostWidthForParticles<interpOrder>())};
+
+    std::shared_ptr<SAMRAI::hier::PatchDescriptor> descriptor{
+        std::make_shared<SAMRAI::hier::PatchDescriptor>()};
+    int dataId;
+
+    Patch1D coarse;
+    Patch1D fine;
+};
+
+
+
+
+template<std::size_t interpOrder, std::size_t refinedParticleNbr, ParticlesDataSplitType splitType>
+void refineParticles(benchmark::State& state)
+{
+    using Bench_t = ParticlesRefineBench<interpOrder>;
+    using RefineOperator_t
+        = ParticlesRefineOperator<1, interpOrder, splitType, refinedParticleNbr,
+                                  Split<1, interpOrder>>;
+
+    Bench_t bench{static_cast<int>(state.range(0)), static_cast<std::size_t>(state.range(1))};
+    RefineOperator_t refineOperator;
+
+    auto overlap = splitType == ParticlesDataSplitType::interior ? bench.interiorOverlap()
+                                                                 : bench.coarseBoundaryOverlap();
+    SAMRAI::hier::IntVector ratio{bench.dimension, Bench_t::ratio};
+
+    auto& fineParticles = bench.fine.particles(bench.dataId);
+
+    for (auto _ : state)
+    {
+        refineOperator.refine(bench.fine.patch, bench.coarse.patch, bench.dataId, bench.dataId,
+                              overlap, ratio);
+
+        state.PauseTiming();
+        fineParticles.domainParticles.clear();
+        fineParticles.levelGhostParticles.clear();
+        state.ResumeTiming();
+    }
+
+    auto nbrCoarseParticles = bench.coarse.particles(bench.dataId).domainParticles.size();
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * nbrCoarseParticles));
+}
+
+
+
+
+// splits particles one by one in fixed size arrays, the inner loop of the refine operator
+template<std::size_t interpOrder, std::size_t refinedParticleNbr>
+void splitParticles(benchmark::State& state)
+{
+    auto particles = uniformParticles<1>(static_cast<std::uint32_t>(state.range(0)),
+                                         static_cast<std::size_t>(state.range(1)));
+
+    Split<1, interpOrder> split{Point<int32, 1>{2}, refinedParticleNbr};
+    std::array<Particle<1>, refinedParticleNbr> babies;
+
+    for (auto _ : state)
+    {
+        for (auto const& particle : particles)
+        {
+            split(particle, babies);
+            benchmark::DoNotOptimize(babies.data());
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * particles.size()));
+}
+
+
+
+
+BENCHMARK_TEMPLATE(splitParticles, 1, 2)->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(splitParticles, 2, 3)->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(splitParticles, 3, 3)->Apply(particleArguments<1>);
+
+BENCHMARK_TEMPLATE(refineParticles, 1, 2, ParticlesDataSplitType::interior)
+    ->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(refineParticles, 2, 3, ParticlesDataSplitType::interior)
+    ->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(refineParticles, 3, 3, ParticlesDataSplitType::interior)
+    ->Apply(particleArguments<1>);
+
+BENCHMARK_TEMPLATE(refineParticles, 1, 2, ParticlesDataSplitType::coarseBoundary)
+    ->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(refineParticles, 2, 3, ParticlesDataSplitType::coarseBoundary)
+    ->Apply(particleArguments<1>);
+BENCHMARK_TEMPLATE(refineParticles, 3, 3, ParticlesDataSplitType::coarseBoundary)
+    ->Apply(particleArguments<1>);
+
+
+
+
+int main(int argc, char** argv)
+{
+    SAMRAI::tbox::SAMRAI_MPI::init(&argc, &argv);
+    SAMRAI::tbox::SAMRAIManager::initialize();
+    SAMRAI::tbox::SAMRAIManager::startup();
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    SAMRAI::tbox::SAMRAIManager::shutdown();
+    SAMRAI::tbox::SAMRAIManager::finalize();
+    SAMRAI::tbox::SAMRAI_MPI::finalize();
+
+    return 0;
+}
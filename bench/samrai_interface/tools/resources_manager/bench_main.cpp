@@ -0,0 +1,148 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <SAMRAI/geom/CartesianPatchGeometry.h>
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+#include <SAMRAI/hier/VariableDatabase.h>
+#include <SAMRAI/tbox/SAMRAIManager.h>
+#include <SAMRAI/tbox/SAMRAI_MPI.h>
+
+#include <benchmark/benchmark.h>
+
+#include "data/electromag/electromag.h"
+#include "data/grid/gridlayout.h"
+#include "data/grid/gridlayout_impl.h"
+#include "data/ions/ion_population/ion_population.h"
+#include "data/ions/ions.h"
+#include "data/ndarray/ndarray_vector.h"
+#include "data/particles/particle_array.h"
+#include "data/vecfield/vecfield.h"
+#include "tools/resources_manager.h"
+
+using namespace PHARE::core;
+using namespace PHARE::amr_interface;
+
+
+
+using GridLayout_t = GridLayout<GridLayoutImplYee<1, 1>>;
+using VecField_t   = VecField<NdArrayVector1D<>, HybridQuantity>;
+using Population_t = IonPopulation<ParticleArray<1>, VecField_t, GridLayout_t>;
+using Ions_t       = Ions<Population_t, GridLayout_t>;
+using Electromag_t = Electromag<VecField_t>;
+
+
+
+PHARE::initializer::PHAREDict<1> ionsDict(std::size_t nbrPopulations)
+{
+    PHARE::initializer::PHAREDict<1> dict;
+    dict["name"]           = std::string{"ions"};
+    dict["nbrPopulations"] = nbrPopulations;
+
+    for (std::size_t iPop = 0; iPop < nbrPopulations; ++iPop)
+    {
+        auto& pop                          = dict["pop" + std::to_string(iPop)];
+        pop["name"]                        = "protons" + std::to_string(iPop);
+        pop["mass"]                        = 1.;
+        pop["ParticleInitializer"]["name"] = std::string{"DummyParticleInitializer"};
+    }
+    return dict;
+}
+
+
+
+
+// one 1D patch of 100 cells on which the electromagnetic field and the ions, made of
+// nbrPopulations populations, are allocated. These are the users solvers and messengers set
+// on each patch of a level.
+struct ResourcesBench
+{
+    explicit ResourcesBench(std::size_t nbrPopulations)
+        : ions{ionsDict(nbrPopulations)}
+        , patch{SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, 0},
+                                  SAMRAI::hier::Index{dimension, 99}, SAMRAI::hier::BlockId{0}},
+                SAMRAI::hier::VariableDatabase::getDatabase()->getPatchDescriptor()}
+    {
+        patch.setPatchGeometry(std::make_shared<SAMRAI::geom::CartesianPatchGeometry>(
+            SAMRAI::hier::IntVector::getOne(dimension), touchesRegular, SAMRAI::hier::BlockId{0},
+            &dx, &lower, &upper));
+
+        resourcesManager.registerResources(electromag);
+        resourcesManager.registerResources(ions);
+        resourcesManager.allocate(electromag, patch, 0.);
+        resourcesManager.allocate(ions, patch, 0.);
+    }
+
+
+    SAMRAI::tbox::Dimension dimension{1};
+    double dx{0.01};
+    double lower{0.};
+    double upper{1.};
+    SAMRAI::hier::PatchGeometry::TwoDimBool touchesRegular{dimension, false};
+
+    ResourcesManager<GridLayout_t> resourcesManager;
+    Electromag_t electromag{"EM"};
+    Ions_t ions;
+    SAMRAI::hier::Patch patch;
+};
+
+
+
+
+// what each patch of a patch loop paid before handles: the names of all the resources of the
+// users are built and looked up
+void setOnPatchByNames(benchmark::State& state)
+{
+    ResourcesBench bench{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        auto dataOnPatch = bench.resourcesManager.setOnPatch(bench.patch, bench.electromag,
+                                                             bench.ions);
+        benchmark::DoNotOptimize(&bench.ions.density());
+    }
+}
+
+
+
+// patch loops resolve the handles once, then set the users on each patch by patch data ID
+void setOnPatchByHandles(benchmark::State& state)
+{
+    ResourcesBench bench{static_cast<std::size_t>(state.range(0))};
+    auto const handles = bench.resourcesManager.getHandles(bench.electromag, bench.ions);
+
+    for (auto _ : state)
+    {
+        auto dataOnPatch = bench.resourcesManager.setOnPatch(bench.patch, handles,
+                                                             bench.electromag, bench.ions);
+        benchmark::DoNotOptimize(&bench.ions.density());
+    }
+    state.counters["resources"] = static_cast<double>(handles.resources.size());
+}
+
+
+
+
+BENCHMARK(setOnPatchByNames)->Arg(1)->Arg(4)->Arg(8);
+BENCHMARK(setOnPatchByHandles)->Arg(1)->Arg(4)->Arg(8);
+
+
+
+
+int main(int argc, char** argv)
+{
+    SAMRAI::tbox::SAMRAI_MPI::init(&argc, &argv);
+    SAMRAI::tbox::SAMRAIManager::initialize();
+    SAMRAI::tbox::SAMRAIManager::startup();
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    SAMRAI::tbox::SAMRAIManager::shutdown();
+    SAMRAI::tbox::SAMRAIManager::finalize();
+    SAMRAI::tbox::SAMRAI_MPI::finalize();
+
+    return 0;
+}
@@ -56,6 +56,16 @@ namespace core
         {
         }
 
+        //! builds the field on the memory of storage, e.g. taken from a MemoryPool
+        template<std::size_t dim>
+        Field(std::string name, PhysicalQuantity qty, std::array<uint32_t, dim> const& dims,
+              typename NdArrayImpl::storage_type&& storage)
+            : NdArrayImpl{dims, std::move(storage)}
+            , name_{std::move(name)}
+            , qty_{qty}
+        {
+        }
+
         std::string name() const { return name_; }
 
 
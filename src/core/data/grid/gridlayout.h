@@ -619,6 +619,94 @@ namespace core
 
 
 
+        /** @brief physicalBox returns the box of the physical nodes of the field, in local
+         * indexes. Its upper bound is included.
+         */
+        template<typename NdArrayImpl>
+        Box<uint32, dimension>
+        physicalBox(Field<NdArrayImpl, HybridQuantity::Scalar> const& field) const
+        {
+            Point<uint32, dimension> lower;
+            Point<uint32, dimension> upper;
+            for (auto iDir = 0u; iDir < dimension; ++iDir)
+            {
+                lower[iDir] = physicalStartIndex(field, static_cast<Direction>(iDir));
+                upper[iDir] = physicalEndIndex(field, static_cast<Direction>(iDir));
+            }
+            return Box{lower, upper};
+        }
+
+
+
+        /** @brief range version of deriv(): result(index) = factor * d(operand)/d(direction)
+         * for all indexes of the box, its upper bound included.
+         *
+         * The centering of the operand is resolved once per call, and the box is swept row by
+         * row on raw pointers, so that the loop over the contiguous dimension vectorizes.
+         * Gives the same values as factor * deriv(operand, index, DirectionTag{}).
+         */
+        template<typename Field, typename ResultField, typename DirectionTag>
+        void deriv(Field const& operand, Box<uint32, dimension> const& box, ResultField& result,
+                   DirectionTag, double factor = 1.) const
+        {
+            derivRange_<DirectionTag::direction, false>(operand, box, result, result, factor);
+        }
+
+
+
+        /** @brief range version of deriv() that adds the derivative to a base field:
+         * result(index) = base(index) + factor * d(operand)/d(direction) for all indexes of
+         * the box. base may be result, otherwise it must have the same shape.
+         */
+        template<typename Field, typename ResultField, typename DirectionTag>
+        void addDeriv(Field const& operand, Box<uint32, dimension> const& box,
+                      ResultField const& base, ResultField& result, DirectionTag,
+                      double factor) const
+        {
+            derivRange_<DirectionTag::direction, true>(operand, box, base, result, factor);
+        }
+
+
+
+        /** @brief range version of laplacian(): result(index) is the laplacian of operand
+         * for all indexes of the box, its upper bound included. Gives the same values as
+         * laplacian(operand, index).
+         */
+        template<typename Field, typename ResultField>
+        void laplacian(Field const& operand, Box<uint32, dimension> const& box,
+                       ResultField& result) const
+        {
+            static_assert(Field::dimension == dimension,
+                          "field dimension must be equal to gridlayout dimension");
+
+            std::array<std::ptrdiff_t, dimension> strides;
+            std::array<double, dimension> inverseMeshSize2;
+            for (auto iDir = 0u; iDir < dimension; ++iDir)
+            {
+                strides[iDir]          = static_cast<std::ptrdiff_t>(stride_(operand, iDir));
+                inverseMeshSize2[iDir] = inverseMeshSize_[iDir] * inverseMeshSize_[iDir];
+            }
+
+            forEachRow_(box, [&](auto const& rowStart, std::ptrdiff_t rowSize) {
+                auto const* in = operand.data() + linearIndex_(operand, rowStart);
+                auto* out      = result.data() + linearIndex_(result, rowStart);
+
+                for (std::ptrdiff_t i = 0; i < rowSize; ++i)
+                {
+                    auto lap = inverseMeshSize2[0]
+                               * (in[i + strides[0]] - 2.0 * in[i] + in[i - strides[0]]);
+                    for (auto iDir = 1u; iDir < dimension; ++iDir)
+                    {
+                        lap += inverseMeshSize2[iDir]
+                               * (in[i + strides[iDir]] - 2.0 * in[i] + in[i - strides[iDir]]);
+                    }
+                    out[i] = lap;
+                }
+            });
+        }
+
+
+
         /**
          * @brief localToAMR returns the AMR index associated with the given local one.
          * This method only deals with **cell** indexes.
@@ -1279,6 +1367,123 @@ namespace core
 
 
 
+        template<Direction direction, bool addToBase, typename Field, typename ResultField>
+        void derivRange_(Field const& operand, Box<uint32, dimension> const& box,
+                         ResultField const& base, ResultField& result, double factor) const
+        {
+            static_assert(Field::dimension == dimension,
+                          "field dimension must be equal to gridlayout dimension");
+            constexpr auto iDir = static_cast<uint32>(direction);
+
+            if (centering(operand.physicalQuantity())[iDir] == QtyCentering::primal)
+            {
+                derivKernel_<direction, QtyCentering::primal, addToBase>(operand, box, base, result,
+                                                                         factor);
+            }
+            else
+            {
+                derivKernel_<direction, QtyCentering::dual, addToBase>(operand, box, base, result,
+                                                                       factor);
+            }
+        }
+
+
+
+        // the operand is read around next/prevIndex() of the result index, offsets that are
+        // known at compile time once the centering of the operand is
+        template<Direction direction, QtyCentering operandCentering, bool addToBase,
+                 typename Field, typename ResultField>
+        void derivKernel_(Field const& operand, Box<uint32, dimension> const& box,
+                          ResultField const& base, ResultField& result, double factor) const
+        {
+            constexpr auto iDir = static_cast<uint32>(direction);
+            constexpr auto next = nextIndexTable_[centering2int(operandCentering)];
+            constexpr auto prev = prevIndexTable_[centering2int(operandCentering)];
+
+            auto const stride          = static_cast<std::ptrdiff_t>(stride_(operand, iDir));
+            auto const nextOffset      = next * stride;
+            auto const prevOffset      = prev * stride;
+            auto const inverseMeshSize = inverseMeshSize_[iDir];
+
+            forEachRow_(box, [&](auto const& rowStart, std::ptrdiff_t rowSize) {
+                auto const* in  = operand.data() + linearIndex_(operand, rowStart);
+                auto const* add = base.data() + linearIndex_(base, rowStart);
+                auto* out       = result.data() + linearIndex_(result, rowStart);
+
+                for (std::ptrdiff_t i = 0; i < rowSize; ++i)
+                {
+                    auto derivative = factor * (inverseMeshSize * (in[i + nextOffset]
+                                                                   - in[i + prevOffset]));
+                    if constexpr (addToBase)
+                        out[i] = add[i] + derivative;
+                    else
+                        out[i] = derivative;
+                }
+            });
+        }
+
+
+
+        // calls fn(rowStart, rowSize) for each row of the box along the last, contiguous,
+        // dimension. Does nothing if the box is empty.
+        template<typename Fn>
+        static void forEachRow_(Box<uint32, dimension> const& box, Fn&& fn)
+        {
+            for (auto iDir = 0u; iDir < dimension; ++iDir)
+            {
+                if (box.upper[iDir] < box.lower[iDir])
+                    return;
+            }
+
+            constexpr auto last = dimension - 1;
+            auto const rowSize
+                = static_cast<std::ptrdiff_t>(box.upper[last]) - box.lower[last] + 1;
+            auto rowStart = box.lower;
+
+            if constexpr (dimension == 1)
+            {
+                fn(rowStart, rowSize);
+            }
+            else if constexpr (dimension == 2)
+            {
+                for (rowStart[0] = box.lower[0]; rowStart[0] <= box.upper[0]; ++rowStart[0])
+                    fn(rowStart, rowSize);
+            }
+            else if constexpr (dimension == 3)
+            {
+                for (rowStart[0] = box.lower[0]; rowStart[0] <= box.upper[0]; ++rowStart[0])
+                    for (rowStart[1] = box.lower[1]; rowStart[1] <= box.upper[1]; ++rowStart[1])
+                        fn(rowStart, rowSize);
+            }
+        }
+
+
+
+        //! number of elements between two consecutive nodes of array along direction iDir
+        template<typename NdArray>
+        static std::size_t stride_(NdArray const& array, uint32 iDir)
+        {
+            return array.strides()[iDir];
+        }
+
+
+
+        template<typename NdArray>
+        static std::size_t linearIndex_(NdArray const& array,
+                                        Point<uint32, dimension> const& index)
+        {
+            auto const strides = array.strides();
+            std::size_t iData  = 0;
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                iData += strides[iDim] * index[iDim];
+            }
+            return iData;
+        }
+
+
+
+
         std::array<double, dimension> meshSize_;
         Point<double, dimension> origin_;
         std::array<uint32, dimension> nbrPhysicalCells_;
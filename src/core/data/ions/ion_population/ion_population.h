@@ -236,6 +236,28 @@ namespace core
 
 
 
+        //! sets the buffers at the given index of getParticleArrayNames() and
+        //! getFieldNamesAndQuantities(), which only have one
+        void setBuffer(std::size_t index, ParticlesPack<ParticleArray>* pack)
+        {
+            if (index != 0)
+                throw std::runtime_error("Error - invalid particle resource index");
+            particles_ = pack;
+        }
+
+
+
+        void setBuffer(std::size_t index, field_type* field)
+        {
+            if (index != 0)
+                throw std::runtime_error("Error - invalid density buffer index");
+            rho_ = field;
+        }
+
+
+
+        auto getCompileTimeResourcesUserList() const { return std::forward_as_tuple(flux_); }
+
         auto getCompileTimeResourcesUserList() { return std::forward_as_tuple(flux_); }
 
 
@@ -195,10 +195,30 @@ namespace core
             }
         }
 
+        //! sets the buffer at the given index of getFieldNamesAndQuantities(), which only has one
+        void setBuffer(std::size_t index, field_type* field)
+        {
+            if (index != 0)
+            {
+                throw std::runtime_error("Error - invalid density buffer index");
+            }
+            rho_ = field;
+        }
+
 
 
+        std::vector<IonPopulation> const& getRunTimeResourcesUserList() const
+        {
+            return populations_;
+        }
+
         std::vector<IonPopulation>& getRunTimeResourcesUserList() { return populations_; }
 
+        auto getCompileTimeResourcesUserList() const
+        {
+            return std::forward_as_tuple(bulkVelocity_);
+        }
+
         auto getCompileTimeResourcesUserList() { return std::forward_as_tuple(bulkVelocity_); }
 
 
@@ -11,7 +11,7 @@ namespace PHARE
 namespace core
 {
     void maxwellianVelocity(std::array<double, 3> V, std::array<double, 3> Vth,
-                            std::mt19937_64 generator, std::array<double, 3>& partVelocity)
+                            std::mt19937_64& generator, std::array<double, 3>& partVelocity)
     {
         std::normal_distribution<> maxwellX(V[0], Vth[0]);
         std::normal_distribution<> maxwellY(V[1], Vth[1]);
@@ -1,9 +1,15 @@
 #ifndef PHARE_FLUID_PARTICLE_INITIALIZER_H
 #define PHARE_FLUID_PARTICLE_INITIALIZER_H
 
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <random>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "data/grid/gridlayoutdefs.h"
 #include "data/ions/particle_initializers/particle_initializer.h"
@@ -11,6 +17,7 @@
 #include "data_provider.h"
 #include "hybrid/hybrid_quantities.h"
 #include "utilities/point/point.h"
+#include "utilities/random/philox.h"
 #include "utilities/types.h"
 
 namespace PHARE
@@ -18,7 +25,7 @@ namespace PHARE
 namespace core
 {
     void maxwellianVelocity(std::array<double, 3> V, std::array<double, 3> Vth,
-                            std::mt19937_64 generator, std::array<double, 3>& partVelocity);
+                            std::mt19937_64& generator, std::array<double, 3>& partVelocity);
 
 
     std::array<double, 3> basisTransform(const std::array<std::array<double, 3>, 3> basis,
@@ -31,6 +38,13 @@ namespace core
 
     /** @brief a MaxwellianParticleInitializer is a ParticleInitializer that loads particles from a
      * local Maxwellian distribution given density, bulk velocity and thermal velocity profiles.
+     *
+     * Random numbers are drawn from a Philox4x32 generator keyed by the seed, and counted by the
+     * AMR index of the cell and the index of the particle in the cell. A particle thus does not
+     * depend on the order in which cells are loaded, so that cells are loaded concurrently when
+     * PHARE is built with OpenMP, and a domain gets the same particles whatever the number of
+     * threads and its decomposition in patches. The mesh size is mixed in the key so that the
+     * same AMR cell of two levels draws different numbers.
      */
     template<typename ParticleArray, typename GridLayout>
     class MaxwellianParticleInitializer : public ParticleInitializer<ParticleArray, GridLayout>
@@ -39,20 +53,45 @@ namespace core
         static constexpr auto dimension = GridLayout::dimension;
 
     public:
+        static constexpr std::uint64_t defaultSeed = 1;
+
         MaxwellianParticleInitializer(PHARE::initializer::ScalarFunction<dimension> density,
                                       PHARE::initializer::VectorFunction<dimension> bulkVelocity,
                                       PHARE::initializer::VectorFunction<dimension> thermalVelocity,
                                       double particleCharge, uint32 nbrParticlesPerCell,
                                       Basis basis = Basis::Cartesian,
                                       PHARE::initializer::VectorFunction<dimension> magneticField
-                                      = nullptr)
+                                      = nullptr,
+                                      std::uint64_t seed = defaultSeed)
+            : MaxwellianParticleInitializer(
+                PHARE::initializer::vectorize<dimension>(density),
+                PHARE::initializer::vectorize<dimension>(bulkVelocity),
+                PHARE::initializer::vectorize<dimension>(thermalVelocity), particleCharge,
+                nbrParticlesPerCell, basis, PHARE::initializer::vectorize<dimension>(magneticField),
+                seed)
+        {
+        }
+
+
+        /**
+         * @brief builds a MaxwellianParticleInitializer from batched profiles, which are called
+         * once per loaded patch with the coordinates of all its cells
+         */
+        MaxwellianParticleInitializer(
+            PHARE::initializer::ScalarArrayFunction<dimension> density,
+            PHARE::initializer::VectorArrayFunction<dimension> bulkVelocity,
+            PHARE::initializer::VectorArrayFunction<dimension> thermalVelocity,
+            double particleCharge, uint32 nbrParticlesPerCell, Basis basis = Basis::Cartesian,
+            PHARE::initializer::VectorArrayFunction<dimension> magneticField = nullptr,
+            std::uint64_t seed = defaultSeed)
             : density_{density}
             , bulkVelocity_{bulkVelocity}
             , thermalVelocity_{thermalVelocity}
+            , magneticField_{magneticField}
             , particleCharge_{particleCharge}
             , nbrParticlePerCell_{nbrParticlesPerCell}
             , basis_{basis}
-            , magneticField_{magneticField}
+            , seed_{seed}
         {
         }
 
@@ -60,21 +99,30 @@ namespace core
 
         /**
          * @brief load particles in a ParticleArray in a domain defined by the given layout
+         *
+         * The profiles are evaluated first, once for all the cells of the layout, serially since
+         * they may be user functions that are not thread safe. The particles are then appended
+         * to the array, which is resized once.
          */
         virtual void loadParticles(ParticleArray& particles,
                                    GridLayout const& layout) const override
         {
-            if constexpr (dimension == 1)
-            {
-                loadParticles1D_(particles, layout);
-            }
-            else if constexpr (dimension == 2)
-            {
-                loadParticles2D_(particles, layout);
-            }
-            else if constexpr (dimension == 3)
+            auto const cells    = physicalCells_(layout);
+            auto const profiles = cellProfiles_(layout, cells);
+
+            auto const firstParticle = particles.size();
+            particles.resize(firstParticle + cells.size() * nbrParticlePerCell_);
+
+            auto const key      = key_(layout);
+            auto const nbrCells = static_cast<long>(cells.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (long iCell = 0; iCell < nbrCells; ++iCell)
             {
-                loadParticles3D_(particles, layout);
+                auto first = firstParticle + static_cast<std::size_t>(iCell) * nbrParticlePerCell_;
+                loadCell_(particles, first, profiles[static_cast<std::size_t>(iCell)], key);
             }
         }
 
@@ -84,297 +132,250 @@ namespace core
 
 
     private:
-        void loadParticles1D_(ParticleArray& particles, GridLayout const& layout) const
+        //! coordinates of the cells of a patch, one array per direction
+        using Coordinates = std::array<PHARE::initializer::CoordinateArray, dimension>;
+
+        //! what the particles of a cell are drawn from
+        struct CellProfile
         {
-            auto const meshSize = layout.meshSize();
-            auto const& dx      = meshSize[0];
+            std::array<int, dimension> AMRCell;
+            double weight;
+            std::array<double, 3> V;   // cell centered bulk velocity
+            std::array<double, 3> Vth; // cell centered thermal speed
+            std::array<std::array<double, 3>, 3> basis;
+        };
+
 
-            /* get indices start and stop. we take primal/primal/primal because
-               that is what GridLayout::cellCenteredCoordinate() requires */
-            uint32 ix0 = layout.physicalStartIndex(QtyCentering::primal, Direction::X);
-            uint32 ix1 = layout.physicalEndIndex(QtyCentering::primal, Direction::X);
 
-            double cellVolume = dx;
-            Point origin      = layout.origin();
+        // we loop over the cells but use primal indices because of
+        // GridLayout::cellCenteredCoordinates, therefore the primal end index is excluded.
+        static std::vector<std::array<uint32, dimension>> physicalCells_(GridLayout const& layout)
+        {
+            std::array<uint32, dimension> start;
+            std::array<uint32, dimension> end;
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                auto direction = static_cast<Direction>(iDim);
+                start[iDim]    = layout.physicalStartIndex(QtyCentering::primal, direction);
+                end[iDim]      = layout.physicalEndIndex(QtyCentering::primal, direction);
+            }
 
-            // random seed and generator needed to load maxwellian velocity
-            // and random position with the cell
-            std::random_device randSeed;
-            // std::mt19937_64 generator(randSeed());
-            std::mt19937_64 generator(1); // TODO constant seed should be usable for Debug mode.
+            std::vector<std::array<uint32, dimension>> cells;
+            for (uint32 ix = start[0]; ix < end[0]; ++ix)
+            {
+                if constexpr (dimension == 1)
+                {
+                    cells.push_back({{ix}});
+                }
+                else
+                {
+                    for (uint32 iy = start[1]; iy < end[1]; ++iy)
+                    {
+                        if constexpr (dimension == 2)
+                        {
+                            cells.push_back({{ix, iy}});
+                        }
+                        else
+                        {
+                            for (uint32 iz = start[2]; iz < end[2]; ++iz)
+                            {
+                                cells.push_back({{ix, iy, iz}});
+                            }
+                        }
+                    }
+                }
+            }
+            return cells;
+        }
 
-            // beware: we're looping over the cell but use primal indices because of
-            // GridLayout::cellCenteredCoordinates
-            // therefore i(x,y,z)1 must be excluded.
 
-            // gab references for convenience
-            // auto& density         = *density_;
-            // auto& bulkVelocity    = *bulkVelocity_;
-            // auto& thermalVelocity = *thermalVelocity_;
 
-            for (uint32 ix = ix0; ix < ix1; ++ix)
+        std::vector<CellProfile>
+        cellProfiles_(GridLayout const& layout,
+                      std::vector<std::array<uint32, dimension>> const& cells) const
+        {
+            double cellVolume = 1.;
+            for (auto dl : layout.meshSize())
             {
-                double n;                  // cell centered density
-                std::array<double, 3> Vth; // cell centered thermal speed
-                std::array<double, 3> V;   // cell centered bulk velocity
-                std::array<double, 3> particleVelocity;
-                std::array<std::array<double, 3>, 3> basis;
-
-                // get the coordinate of the current cell
-                auto coord = layout.cellCenteredCoordinates(ix);
-                auto x     = coord[0];
+                cellVolume *= dl;
+            }
 
-                // now get density, velocity and thermal speed values
-                n   = density_(x);
-                V   = bulkVelocity_(x);
-                Vth = thermalVelocity_(x);
+            Coordinates coords;
+            for (auto& coord : coords)
+            {
+                coord.resize(cells.size());
+            }
 
-                // weight for all particles in this cell
-                auto cellWeight = n * cellVolume / nbrParticlePerCell_;
+            for (std::size_t iCell = 0; iCell < cells.size(); ++iCell)
+            {
+                auto const& cell = cells[iCell];
 
-                std::uniform_real_distribution<float> randPosX(0., 1.);
+                Point<double, dimension> coord;
+                if constexpr (dimension == 1)
+                    coord = layout.cellCenteredCoordinates(cell[0]);
+                else if constexpr (dimension == 2)
+                    coord = layout.cellCenteredCoordinates(cell[0], cell[1]);
+                else
+                    coord = layout.cellCenteredCoordinates(cell[0], cell[1], cell[2]);
 
-                if (basis_ == Basis::Magnetic)
+                for (auto iDim = 0u; iDim < dimension; ++iDim)
                 {
-                    auto B = magneticField_(x);
-                    localMagneticBasis(B, basis);
+                    coords[iDim][iCell] = coord[iDim];
                 }
+            }
 
-                for (uint32 ipart = 0; ipart < nbrParticlePerCell_; ++ipart)
-                {
-                    maxwellianVelocity(V, Vth, generator, particleVelocity);
+            // each profile is evaluated once on all the cells
+            auto const density         = evaluate_(density_, coords);
+            auto const bulkVelocity    = evaluate_(bulkVelocity_, coords);
+            auto const thermalVelocity = evaluate_(thermalVelocity_, coords);
 
-                    if (basis_ == Basis::Magnetic)
-                    {
-                        particleVelocity = basisTransform(basis, particleVelocity);
-                    }
+            std::array<PHARE::initializer::ValueArray, 3> magneticField;
+            if (basis_ == Basis::Magnetic)
+            {
+                magneticField = evaluate_(magneticField_, coords);
+            }
 
-                    std::array<float, dimension> delta = {{randPosX(generator)}};
+            std::vector<CellProfile> profiles(cells.size());
+            for (std::size_t iCell = 0; iCell < cells.size(); ++iCell)
+            {
+                auto& profile = profiles[iCell];
 
-                    Particle<dimension> tmpParticle;
+                // particle iCell is in AMR index
+                profile.AMRCell = layout.localToAMR(Point<uint32, dimension>{cells[iCell]})
+                                      .template toArray<int>();
 
-                    // particle iCell is in AMR index
-                    auto AMRCellIndex = layout.localToAMR(Point{ix});
+                // weight for all particles in this cell
+                profile.weight = density[iCell] * cellVolume / nbrParticlePerCell_;
 
-                    tmpParticle.weight = cellWeight;
-                    tmpParticle.charge = particleCharge_;
-                    tmpParticle.iCell  = AMRCellIndex.template toArray<int>();
-                    tmpParticle.delta  = delta;
-                    tmpParticle.v      = particleVelocity;
+                for (auto iComp = 0u; iComp < 3; ++iComp)
+                {
+                    profile.V[iComp]   = bulkVelocity[iComp][iCell];
+                    profile.Vth[iComp] = thermalVelocity[iComp][iCell];
+                }
 
-                    particles.push_back(std::move(tmpParticle));
+                if (basis_ == Basis::Magnetic)
+                {
+                    localMagneticBasis({{magneticField[0][iCell], magneticField[1][iCell],
+                                         magneticField[2][iCell]}},
+                                       profile.basis);
                 }
             }
-        }
 
+            return profiles;
+        }
 
 
 
-        void loadParticles2D_(ParticleArray& particles, GridLayout const& layout) const
+        static void checkSize_(PHARE::initializer::ValueArray const& values, std::size_t size)
         {
-            auto const meshSize = layout.meshSize();
-            auto const& dx      = meshSize[0];
-            auto const& dy      = meshSize[1];
-
-            /* get indices start and stop. we take primal/primal/primal because
-               that is what GridLayout::cellCenteredCoordinate() requires */
-            auto ix0 = layout.physicalStartIndex(QtyCentering::primal, Direction::X);
-            auto ix1 = layout.physicalEndIndex(QtyCentering::primal, Direction::X);
-            auto iy0 = layout.physicalStartIndex(QtyCentering::primal, Direction::Y);
-            auto iy1 = layout.physicalEndIndex(QtyCentering::primal, Direction::Y);
-
-            auto cellVolume = dx * dy;
-            auto origin     = layout.origin();
-
-            // random seed and generator needed to load maxwellian velocity
-            // and random position with the cell
-            std::random_device randSeed;
-            std::mt19937_64 generator(randSeed());
-
-            // beware: we're looping over the cell but use primal indices because of
-            // GridLayout::cellCenteredCoordinates
-            // therefore i(x,y,z)1 must be excluded.
-            // gab references for convenience
-            // auto& density         = *density_;
-            // auto& bulkVelocity    = *bulkVelocity_;
-            // auto& thermalVelocity = *thermalVelocity_;
-
-
-            for (uint32 ix = ix0; ix < ix1; ++ix)
+            if (values.size() != size)
             {
-                for (uint32 iy = iy0; iy < iy1; ++iy)
-                {
-                    double n;                  // cell centered density
-                    std::array<double, 3> Vth; // cell centered thermal speed
-                    std::array<double, 3> V;   // cell centered bulk velocity
-                    std::array<double, 3> particleVelocity;
-                    std::array<std::array<double, 3>, 3> basis;
-
-                    // get the coordinate of the current cell
-                    auto coord = layout.cellCenteredCoordinates(ix, iy);
-                    auto x     = coord[0];
-                    auto y     = coord[1];
-
-                    // now get density, velocity and thermal speed values
-                    n   = density_(x, y);
-                    V   = bulkVelocity_(x, y);
-                    Vth = thermalVelocity_(x, y);
-
-                    // weight for all particles in this cell
-                    auto cellWeight = n * cellVolume / nbrParticlePerCell_;
-                    std::uniform_real_distribution<float> randPosX(0., 1.);
-                    std::uniform_real_distribution<float> randPosY(0., 1.);
-
-                    if (basis_ == Basis::Magnetic)
-                    {
-                        auto B = magneticField_(x, y, origin.z);
-                        localMagneticBasis(B, basis);
-                    }
+                throw std::runtime_error("Error - MaxwellianParticleInitializer - a profile "
+                                         "returned a number of values different from the number "
+                                         "of cells");
+            }
+        }
 
 
-                    for (uint32 ipart = 0; ipart < nbrParticlePerCell_; ++ipart)
-                    {
-                        maxwellianVelocity(V, Vth, generator, particleVelocity);
+        template<typename ArrayFunction>
+        static auto evaluate_(ArrayFunction const& function, Coordinates const& coords)
+        {
+            auto values = std::apply(function, coords);
 
-                        if (basis_ == Basis::Magnetic)
-                        {
-                            particleVelocity = basisTransform(basis, particleVelocity);
-                        }
+            if constexpr (std::is_same_v<decltype(values), PHARE::initializer::ValueArray>)
+            {
+                checkSize_(values, coords[0].size());
+            }
+            else
+            {
+                for (auto const& component : values)
+                {
+                    checkSize_(component, coords[0].size());
+                }
+            }
+            return values;
+        }
 
-                        std::array<float, dimension> delta
-                            = {{randPosX(generator), randPosY(generator)}};
 
-                        Particle<dimension> tmpParticle;
 
-                        // particle iCell is in AMR index
-                        auto AMRCellIndex = layout.localToAMR(Point{ix, iy});
+        Philox4x32::key_type key_(GridLayout const& layout) const
+        {
+            auto const dx = layout.meshSize()[0];
+            std::uint64_t dxBits;
+            std::memcpy(&dxBits, &dx, sizeof(dx));
 
+            return {{static_cast<std::uint32_t>(seed_) ^ static_cast<std::uint32_t>(dxBits),
+                     static_cast<std::uint32_t>(seed_ >> 32)
+                         ^ static_cast<std::uint32_t>(dxBits >> 32)}};
+        }
 
-                        tmpParticle.weight = cellWeight;
-                        tmpParticle.charge = particleCharge_;
-                        tmpParticle.iCell  = AMRCellIndex.template toArray<int>();
-                        tmpParticle.delta  = delta;
-                        tmpParticle.v      = particleVelocity;
 
-                        particles.push_back(std::move(tmpParticle));
-                    }
-                }
+
+        // each particle draws two blocks of four random integers, the first for its velocity and
+        // the second for its position in the cell
+        static Philox4x32::counter_type counter_(std::array<int, dimension> const& AMRCell,
+                                                 uint32 iPart, uint32 block)
+        {
+            Philox4x32::counter_type counter{{0, 0, 0, 2 * iPart + block}};
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                counter[iDim] = static_cast<std::uint32_t>(AMRCell[iDim]);
             }
+            return counter;
         }
 
 
 
-
-        void loadParticles3D_(ParticleArray& particles, GridLayout const& layout) const
+        void loadCell_(ParticleArray& particles, std::size_t first, CellProfile const& profile,
+                       Philox4x32::key_type const& key) const
         {
-            auto const meshSize = layout.meshSize();
-            auto const& dx      = meshSize[0];
-            auto const& dy      = meshSize[1];
-            auto const& dz      = meshSize[2];
-
-            /* get indices start and stop. we take primal/primal/primal because
-               that is what GridLayout::cellCenteredCoordinate() requires */
-            auto ix0 = layout.physicalStartIndex(QtyCentering::primal, Direction::X);
-            auto ix1 = layout.physicalEndIndex(QtyCentering::primal, Direction::X);
-            auto iy0 = layout.physicalStartIndex(QtyCentering::primal, Direction::Y);
-            auto iy1 = layout.physicalEndIndex(QtyCentering::primal, Direction::Y);
-            auto iz0 = layout.physicalStartIndex(QtyCentering::primal, Direction::Z);
-            auto iz1 = layout.physicalEndIndex(QtyCentering::primal, Direction::Z);
-
-            double cellVolume = dx * dy * dz;
-
-            // random seed and generator needed to load maxwellian velocity
-            // and random position with the cell
-            std::random_device randSeed;
-            std::mt19937_64 generator(randSeed());
-
-            // beware: we're looping over the cell but use primal indices because of
-            // GridLayout::cellCenteredCoordinates
-            // therefore i(x,y,z)1 must be excluded.
-
-            // gab references for convenience
-            // auto& density         = *density_;
-            // auto& bulkVelocity    = *bulkVelocity_;
-            // auto& thermalVelocity = *thermalVelocity_;
-
-
-            for (uint32 ix = ix0; ix < ix1; ++ix)
-            {
-                for (uint32 iy = iy0; iy < iy1; ++iy)
-                {
-                    for (uint32 iz = iz0; iz < iz1; ++iz)
-                    {
-                        double n;                  // cell centered density
-                        std::array<double, 3> Vth; // cell centered thermal speed
-                        std::array<double, 3> V;   // cell centered bulk velocity
-                        std::array<double, 3> particleVelocity;
-                        std::array<std::array<double, 3>, 3> basis;
-
-                        // get the coordinate of the current cell
-                        auto coord = layout.cellCenteredCoordinates(ix, iy, iz);
-                        auto x     = coord[0];
-                        auto y     = coord[1];
-                        auto z     = coord[2];
-
-                        // now get density, velocity and thermal speed values
-                        n   = density_(x, y, z);
-                        V   = bulkVelocity_(x, y, z);
-                        Vth = thermalVelocity_(x, y, z);
-
-                        // weight for all particles in this cell
-                        auto cellWeight = n * cellVolume / nbrParticlePerCell_;
-
-                        std::uniform_real_distribution<float> randPosX(0., 1.);
-                        std::uniform_real_distribution<float> randPosY(0., 1.);
-                        std::uniform_real_distribution<float> randPosZ(0., 1.);
-
-                        if (basis_ == Basis::Magnetic)
-                        {
-                            auto B = magneticField_(x, y, z);
-                            localMagneticBasis(B, basis);
-                        }
-
-                        for (uint32 ipart = 0; ipart < nbrParticlePerCell_; ++ipart)
-                        {
-                            maxwellianVelocity(V, Vth, generator, particleVelocity);
+            auto const& V   = profile.V;
+            auto const& Vth = profile.Vth;
 
-                            if (basis_ == Basis::Magnetic)
-                            {
-                                particleVelocity = basisTransform(basis, particleVelocity);
-                            }
+            auto const& cell = profile.AMRCell;
 
-                            std::array<float, 3> delta
-                                = {{randPosX(generator), randPosY(generator), randPosZ(generator)}};
+            for (uint32 iPart = 0; iPart < nbrParticlePerCell_; ++iPart)
+            {
+                auto const velocityDraws = Philox4x32::generate(counter_(cell, iPart, 0), key);
+                auto const positionDraws = Philox4x32::generate(counter_(cell, iPart, 1), key);
 
+                auto const [normalX, normalY] = standardNormals(velocityDraws[0], velocityDraws[1]);
+                auto const normalZ = standardNormals(velocityDraws[2], velocityDraws[3]).first;
 
-                            Particle<dimension> tmpParticle;
+                std::array<double, 3> particleVelocity{{V[0] + Vth[0] * normalX,
+                                                         V[1] + Vth[1] * normalY,
+                                                         V[2] + Vth[2] * normalZ}};
 
-                            // particle iCell is in AMR index
-                            auto AMRCellIndex = layout.localToAMR(Point{ix, iy, iz});
+                if (basis_ == Basis::Magnetic)
+                {
+                    particleVelocity = basisTransform(profile.basis, particleVelocity);
+                }
 
-                            tmpParticle.weight = cellWeight;
-                            tmpParticle.charge = particleCharge_;
-                            tmpParticle.iCell  = AMRCellIndex.template toArray<int>();
-                            tmpParticle.delta  = delta;
-                            tmpParticle.v      = particleVelocity;
+                Particle<dimension> particle;
+                particle.weight = profile.weight;
+                particle.charge = particleCharge_;
+                particle.iCell  = profile.AMRCell;
+                particle.v      = particleVelocity;
+                for (auto iDim = 0u; iDim < dimension; ++iDim)
+                {
+                    particle.delta[iDim] = uniformFloat(positionDraws[iDim]);
+                }
 
-                            particles.push_back(std::move(tmpParticle));
-                        } // end particle looop
-                    }     // end z
-                }         // end y
-            }             // end x
+                particles[first + iPart] = particle;
+            }
         }
 
 
 
-        PHARE::initializer::ScalarFunction<dimension> density_;
-        PHARE::initializer::VectorFunction<dimension> bulkVelocity_;
-        PHARE::initializer::VectorFunction<dimension> thermalVelocity_;
-        PHARE::initializer::VectorFunction<dimension> magneticField_;
+        PHARE::initializer::ScalarArrayFunction<dimension> density_;
+        PHARE::initializer::VectorArrayFunction<dimension> bulkVelocity_;
+        PHARE::initializer::VectorArrayFunction<dimension> thermalVelocity_;
+        PHARE::initializer::VectorArrayFunction<dimension> magneticField_;
 
         double particleCharge_;
         uint32 nbrParticlePerCell_;
         Basis basis_;
+        std::uint64_t seed_;
     };
 } // namespace core
 } // namespace PHARE
@@ -2,6 +2,8 @@
 #define PHARE_PARTICLE_INITIALIZER_FACTORY_H
 
 
+#include <variant>
+
 #include "data_provider.h"
 #include "maxwellian_particle_initializer.h"
 #include "particle_initializer.h"
@@ -26,12 +28,9 @@ namespace core
 
             if (initializerName == "MaxwellianParticleInitializer")
             {
-                auto& density = dict["density"].to<PHARE::initializer::ScalarFunction<dimension>>();
-                auto& bulkVel
-                    = dict["bulkVelocity"].to<PHARE::initializer::VectorFunction<dimension>>();
-
-                auto& thermalVel
-                    = dict["thermalVelocity"].to<PHARE::initializer::VectorFunction<dimension>>();
+                auto density    = scalarProfile_(dict["density"]);
+                auto bulkVel    = vectorProfile_(dict["bulkVelocity"]);
+                auto thermalVel = vectorProfile_(dict["thermalVelocity"]);
 
                 auto charge = dict["charge"].to<double>();
 
@@ -42,29 +41,52 @@ namespace core
 
                 if (basisName == "Cartesian")
                 {
-                    Basis basis = Basis::Cartesian;
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
-                        density, bulkVel, thermalVel, charge, nbrPartPerCell);
+                        density, bulkVel, thermalVel, charge, nbrPartPerCell, Basis::Cartesian);
                 }
                 else if (basisName == "Magnetic")
                 {
-                    Basis basis = Basis::Magnetic;
-                    auto& magnetic
-                        = dict["magnetic"].to<PHARE::initializer::VectorFunction<dimension>>();
+                    auto magnetic = vectorProfile_(dict["magnetic"]);
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
-                        density, bulkVel, thermalVel, charge, nbrPartPerCell);
+                        density, bulkVel, thermalVel, charge, nbrPartPerCell, Basis::Magnetic,
+                        magnetic);
                 }
-                /*
-
-                auto& magnetic
-                    =
- dict["magnetic"].to<PHARE::initializer::VectorFunction<dimension>>();*/
             }
 
             return nullptr;
         }
+
+
+    private:
+        using ScalarFunction      = PHARE::initializer::ScalarFunction<dimension>;
+        using VectorFunction      = PHARE::initializer::VectorFunction<dimension>;
+        using ScalarArrayFunction = PHARE::initializer::ScalarArrayFunction<dimension>;
+        using VectorArrayFunction = PHARE::initializer::VectorArrayFunction<dimension>;
+
+
+        // profiles are given either pointwise or batched, pointwise ones are vectorized
+        template<typename Dict>
+        static ScalarArrayFunction scalarProfile_(Dict& profile)
+        {
+            if (std::holds_alternative<ScalarArrayFunction>(profile.data))
+            {
+                return profile.template to<ScalarArrayFunction>();
+            }
+            return PHARE::initializer::vectorize<dimension>(profile.template to<ScalarFunction>());
+        }
+
+
+        template<typename Dict>
+        static VectorArrayFunction vectorProfile_(Dict& profile)
+        {
+            if (std::holds_alternative<VectorArrayFunction>(profile.data))
+            {
+                return profile.template to<VectorArrayFunction>();
+            }
+            return PHARE::initializer::vectorize<dimension>(profile.template to<VectorFunction>());
+        }
     };
 
 } // namespace core
@@ -1,8 +1,12 @@
 #ifndef PHARE_CORE_DATA_NDARRAY_NDARRAY_VECTOR_H
 #define PHARE_CORE_DATA_NDARRAY_NDARRAY_VECTOR_H
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
 
@@ -10,13 +14,47 @@ namespace PHARE
 {
 namespace core
 {
+    //! number of elements a row of n elements is stored on
+    /** The row is padded to a multiple of rowPadding elements. When the padded row is a multiple
+     * of 4KB, rowPadding more elements are added, so that the same node of consecutive rows do
+     * not alias in the cache and in the load/store buffers.
+     */
+    template<typename DataType, std::size_t rowPadding>
+    constexpr uint32_t paddedRowSize(uint32_t n)
+    {
+        static_assert(rowPadding > 0, "rowPadding must be at least 1");
+
+        if constexpr (rowPadding == 1)
+        {
+            return n;
+        }
+        else
+        {
+            auto padded = static_cast<uint32_t>((n + rowPadding - 1) / rowPadding * rowPadding);
+            if (padded > 0 && (padded * sizeof(DataType)) % 4096 == 0)
+            {
+                padded += rowPadding;
+            }
+            return padded;
+        }
+    }
+
+
+
+
     //! base class for NdArrayVector 1D, 2D and 3D.
     /**
      * This base class gathers all code that is common to 1D, 2D and 3D implementations.
+     *
+     * Memory is obtained from Allocator, for instance core::AlignedAllocator to have rows
+     * start on cache lines, or core::HugePageAllocator.
      */
-    template<typename DataType = double>
+    template<typename DataType = double, typename Allocator = std::allocator<DataType>>
     class NdArrayVectorBase
     {
+    public:
+        using storage_type = std::vector<DataType, Allocator>;
+
     protected:
         NdArrayVectorBase() = delete;
         explicit NdArrayVectorBase(std::size_t size)
@@ -24,18 +62,26 @@ namespace core
         {
         }
 
+        //! builds the array on the memory of storage, whose content is discarded
+        NdArrayVectorBase(std::size_t size, storage_type&& storage)
+            : data_(std::move(storage))
+        {
+            data_.assign(size, DataType{0});
+        }
+
         NdArrayVectorBase(NdArrayVectorBase const& source) = default;
         NdArrayVectorBase(NdArrayVectorBase&& source)      = default;
         NdArrayVectorBase& operator=(NdArrayVectorBase const& source) = default;
         NdArrayVectorBase& operator=(NdArrayVectorBase&& source) = default;
 
-        std::vector<DataType> data_;
+        storage_type data_;
 
     public:
         //! user can check data_type to know of which type the elements are
-        using data_type = DataType;
+        using data_type      = DataType;
+        using allocator_type = Allocator;
 
-        //! return the total number of elements in the container
+        //! return the total number of elements in the container, padding included
         std::size_t size()
         {
             auto s = data_.size();
@@ -43,7 +89,13 @@ namespace core
         }
 
 
+        //! raw pointer to the elements, stored contiguously in C order
+        DataType* data() { return data_.data(); }
+        DataType const* data() const { return data_.data(); }
+
 
+
+        //! iterators go through all elements, padding included
         auto begin() const { return std::begin(data_); }
         auto begin() { return std::begin(data_); }
 
@@ -51,12 +103,16 @@ namespace core
         auto end() const { return std::end(data_); }
 
 
-        void zero()
+        void zero() { std::fill(std::begin(data_), std::end(data_), DataType{0}); }
+
+
+        //! gives the memory of the elements away, e.g. to a MemoryPool. The array is left empty
+        //! and must not be accessed anymore.
+        storage_type releaseStorage()
         {
-            for (auto& v : data_)
-            {
-                v = DataType{0};
-            }
+            storage_type storage;
+            storage.swap(data_);
+            return storage;
         }
     };
 
@@ -66,20 +122,30 @@ namespace core
     /** NdArrayVector1D uses a contiguous std::vector as its internal
      *  data representation. It can store any kind of elements although 'double'
      *  is the default type.
+     *  Its storage is padded to a multiple of rowPadding elements, see paddedRowSize().
      */
-    template<typename DataType = double>
-    class NdArrayVector1D : public NdArrayVectorBase<DataType>
+    template<typename DataType = double, typename Allocator = std::allocator<DataType>,
+             std::size_t rowPadding = 1>
+    class NdArrayVector1D : public NdArrayVectorBase<DataType, Allocator>
     {
+        using Base = NdArrayVectorBase<DataType, Allocator>;
+
     public:
         //! builds an NdArrayVector1D by specifying its number of elements
         explicit NdArrayVector1D(uint32_t nx)
-            : NdArrayVectorBase<DataType>(nx)
+            : Base(paddedRowSize<DataType, rowPadding>(nx))
             , nx_{nx}
         {
         }
 
         explicit NdArrayVector1D(std::array<uint32_t, 1> const& nCell)
-            : NdArrayVectorBase<DataType>(nCell[0])
+            : NdArrayVector1D(nCell[0])
+        {
+        }
+
+        //! builds an NdArrayVector1D reusing the memory of storage, elements are zeroed
+        NdArrayVector1D(std::array<uint32_t, 1> const& nCell, typename Base::storage_type&& storage)
+            : Base(paddedRowSize<DataType, rowPadding>(nCell[0]), std::move(storage))
             , nx_{nCell[0]}
         {
         }
@@ -119,6 +185,12 @@ namespace core
         DataType& operator()(uint32_t i) { return this->data_[i]; }
         DataType const& operator()(uint32_t i) const { return this->data_[i]; }
 
+        //! number of elements in each dimension
+        std::array<uint32_t, 1> shape() const { return {{nx_}}; }
+
+        //! number of stored elements between two consecutive elements in each dimension
+        std::array<std::size_t, 1> strides() const { return {{1}}; }
+
         static const std::size_t dimension = 1;
         using type                         = DataType;
 
@@ -132,23 +204,36 @@ namespace core
      *  efficient for repetitive random access to the memory.
      *  Elements are stored following the C order, i.e. in array(i,j), 'i' is the
      *  slower varying index.
+     *  Rows along 'j' are padded to a multiple of rowPadding elements, see paddedRowSize().
      */
-    template<typename DataType = double>
-    class NdArrayVector2D : public NdArrayVectorBase<DataType>
+    template<typename DataType = double, typename Allocator = std::allocator<DataType>,
+             std::size_t rowPadding = 1>
+    class NdArrayVector2D : public NdArrayVectorBase<DataType, Allocator>
     {
+        using Base = NdArrayVectorBase<DataType, Allocator>;
+
     public:
         //! build a NdArrayVector2D specifying its number of elements in the 1st and 2nd dims.
         NdArrayVector2D(uint32_t nx, uint32_t ny)
-            : NdArrayVectorBase<DataType>(nx * ny)
+            : Base(nx * paddedRowSize<DataType, rowPadding>(ny))
             , nx_{nx}
             , ny_{ny}
+            , rowSize_{paddedRowSize<DataType, rowPadding>(ny)}
         {
         }
 
         explicit NdArrayVector2D(std::array<uint32_t, 2> const& nbCell)
-            : NdArrayVectorBase<DataType>(nbCell[0] * nbCell[1])
+            : NdArrayVector2D(nbCell[0], nbCell[1])
+        {
+        }
+
+        //! builds an NdArrayVector2D reusing the memory of storage, elements are zeroed
+        NdArrayVector2D(std::array<uint32_t, 2> const& nbCell,
+                        typename Base::storage_type&& storage)
+            : Base(nbCell[0] * paddedRowSize<DataType, rowPadding>(nbCell[1]), std::move(storage))
             , nx_{nbCell[0]}
             , ny_{nbCell[1]}
+            , rowSize_{paddedRowSize<DataType, rowPadding>(nbCell[1])}
         {
         }
 
@@ -184,7 +269,7 @@ namespace core
         }
 
         //! read/write data access operator returns C-ordered data.
-        DataType& operator()(uint32_t i, uint32_t j) { return this->data_[j + ny_ * i]; }
+        DataType& operator()(uint32_t i, uint32_t j) { return this->data_[linearIt(i, j)]; }
 
         //! read only access. See read/write.
         DataType const& operator()(uint32_t i, uint32_t j) const
@@ -192,39 +277,62 @@ namespace core
             return this->data_[linearIt(i, j)];
         }
 
+        //! number of elements in each dimension
+        std::array<uint32_t, 2> shape() const { return {{nx_, ny_}}; }
+
+        //! number of stored elements between two consecutive elements in each dimension
+        std::array<std::size_t, 2> strides() const { return {{rowSize_, 1}}; }
+
         static const std::size_t dimension = 2;
         using type                         = DataType;
 
     private:
-        int constexpr linearIt(int i, int j) const { return j + ny_ * i; }
+        std::size_t constexpr linearIt(uint32_t i, uint32_t j) const
+        {
+            return j + static_cast<std::size_t>(rowSize_) * i;
+        }
 
 
-        uint32_t nx_ = 0;
-        uint32_t ny_ = 0;
+        uint32_t nx_      = 0;
+        uint32_t ny_      = 0;
+        uint32_t rowSize_ = 0;
     };
 
 
 
     //! NdArrayVector3D is an implementation for a 3-dimensional container
-    /** behaves as the 2D version.
+    /** behaves as the 2D version, rows along 'k' being padded.
      */
-    template<typename DataType = double>
-    class NdArrayVector3D : public NdArrayVectorBase<DataType>
+    template<typename DataType = double, typename Allocator = std::allocator<DataType>,
+             std::size_t rowPadding = 1>
+    class NdArrayVector3D : public NdArrayVectorBase<DataType, Allocator>
     {
+        using Base = NdArrayVectorBase<DataType, Allocator>;
+
     public:
         NdArrayVector3D(uint32_t nx, uint32_t ny, uint32_t nz)
-            : NdArrayVectorBase<DataType>(nx * ny * nz)
+            : Base(nx * ny * paddedRowSize<DataType, rowPadding>(nz))
             , nx_{nx}
             , ny_{ny}
             , nz_{nz}
+            , rowSize_{paddedRowSize<DataType, rowPadding>(nz)}
         {
         }
 
         explicit NdArrayVector3D(std::array<uint32_t, 3> const& nbCell)
-            : NdArrayVectorBase<DataType>(nbCell[0] * nbCell[1] * nbCell[2])
+            : NdArrayVector3D(nbCell[0], nbCell[1], nbCell[2])
+        {
+        }
+
+        //! builds an NdArrayVector3D reusing the memory of storage, elements are zeroed
+        NdArrayVector3D(std::array<uint32_t, 3> const& nbCell,
+                        typename Base::storage_type&& storage)
+            : Base(nbCell[0] * nbCell[1] * paddedRowSize<DataType, rowPadding>(nbCell[2]),
+                   std::move(storage))
             , nx_{nbCell[0]}
             , ny_{nbCell[1]}
             , nz_{nbCell[2]}
+            , rowSize_{paddedRowSize<DataType, rowPadding>(nbCell[2])}
         {
         }
 
@@ -263,24 +371,34 @@ namespace core
 
         DataType& operator()(uint32_t i, uint32_t j, uint32_t k)
         {
-            return this->data_[k + nz_ * (j + ny_ * i)];
+            return this->data_[linearIt(i, j, k)];
         }
         DataType const& operator()(uint32_t i, uint32_t j, uint32_t k) const
         {
             return this->data_[linearIt(i, j, k)];
         }
 
+        //! number of elements in each dimension
+        std::array<uint32_t, 3> shape() const { return {{nx_, ny_, nz_}}; }
+
+        //! number of stored elements between two consecutive elements in each dimension
+        std::array<std::size_t, 3> strides() const
+        {
+            return {{static_cast<std::size_t>(ny_) * rowSize_, rowSize_, 1}};
+        }
+
         static const std::size_t dimension = 3;
         using type                         = DataType;
 
     private:
-        int constexpr linearIt(uint32_t i, uint32_t j, uint32_t k) const
+        std::size_t constexpr linearIt(uint32_t i, uint32_t j, uint32_t k) const
         {
-            return k + nz_ * (j + ny_ * i);
+            return k + static_cast<std::size_t>(rowSize_) * (j + static_cast<std::size_t>(ny_) * i);
         }
-        uint32_t nx_ = 0;
-        uint32_t ny_ = 0;
-        uint32_t nz_ = 0;
+        uint32_t nx_      = 0;
+        uint32_t ny_      = 0;
+        uint32_t nz_      = 0;
+        uint32_t rowSize_ = 0;
     };
 
 } // namespace core
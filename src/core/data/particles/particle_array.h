@@ -6,27 +6,68 @@
 #include <vector>
 
 #include "particle.h"
+#include "particle_array_soa.h"
 
 namespace PHARE
 {
 namespace core
 {
+    //! AoSParticleArray stores particles as an array of Particle structures
+    template<std::size_t dim>
+    using AoSParticleArray = std::vector<Particle<dim>>;
+
+
+    // the particle layout used by PHARE is chosen at compile time
+    // with the 'soa' CMake option (see PHARE_PARTICLES_SOA)
     // TODO make a real particleArray class that has copy-deleted Ctor
+#ifdef PHARE_PARTICLES_SOA
     template<std::size_t dim>
-    using ParticleArray = std::vector<Particle<dim>>;
+    using ParticleArray = SoAParticleArray<dim>;
+#else
+    template<std::size_t dim>
+    using ParticleArray = AoSParticleArray<dim>;
+#endif
+
 
     template<std::size_t dim>
-    void empty(ParticleArray<dim>& array)
+    void empty(AoSParticleArray<dim>& array)
     {
         array.erase(std::begin(array), std::end(array));
     }
 
     template<std::size_t dim>
-    void swap(ParticleArray<dim>& array1, ParticleArray<dim>& array2)
+    void empty(SoAParticleArray<dim>& array)
+    {
+        array.clear();
+    }
+
+
+    //! bytes allocated by the array, whatever its size
+    template<std::size_t dim>
+    std::size_t allocatedBytes(AoSParticleArray<dim> const& array)
+    {
+        return array.capacity() * sizeof(Particle<dim>);
+    }
+
+    template<std::size_t dim>
+    std::size_t allocatedBytes(SoAParticleArray<dim> const& array)
+    {
+        return array.allocatedBytes();
+    }
+
+
+    template<std::size_t dim>
+    void swap(AoSParticleArray<dim>& array1, AoSParticleArray<dim>& array2)
     {
         std::swap(array1, array2);
     }
 
+    template<std::size_t dim>
+    void swap(SoAParticleArray<dim>& array1, SoAParticleArray<dim>& array2)
+    {
+        array1.swap(array2);
+    }
+
 } // namespace core
 } // namespace PHARE
 
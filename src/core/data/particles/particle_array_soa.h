@@ -0,0 +1,583 @@
+#ifndef PHARE_CORE_DATA_PARTICLES_PARTICLE_ARRAY_SOA_H
+#define PHARE_CORE_DATA_PARTICLES_PARTICLE_ARRAY_SOA_H
+
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "particle.h"
+
+namespace PHARE
+{
+namespace core
+{
+    template<std::size_t dim>
+    class SoAParticleArray;
+
+
+
+    /** @brief VectorProxy references the three components of a vector attribute of a particle
+     * (e.g. its velocity) stored in three separate arrays of a SoAParticleArray. It is used like
+     * the std::array<double, 3> of a Particle: v[1], v = {{vx, vy, vz}}, or converted to an
+     * std::array<double, 3> to get a copy of the values.
+     */
+    template<bool isConst>
+    struct VectorProxy
+    {
+        using component_type = std::conditional_t<isConst, double const, double>;
+
+        std::array<component_type*, 3> components;
+
+
+        component_type& operator[](std::size_t i) const { return *components[i]; }
+
+
+        VectorProxy const& operator=(VectorProxy const& other) const { return assign_(other); }
+
+        template<bool otherIsConst>
+        VectorProxy const& operator=(VectorProxy<otherIsConst> const& other) const
+        {
+            return assign_(other);
+        }
+
+        VectorProxy const& operator=(std::array<double, 3> const& vector) const
+        {
+            return assign_(vector);
+        }
+
+
+        operator std::array<double, 3>() const
+        {
+            return {{*components[0], *components[1], *components[2]}};
+        }
+
+
+        friend bool operator==(VectorProxy const& proxy1, VectorProxy const& proxy2)
+        {
+            return static_cast<std::array<double, 3>>(proxy1)
+                   == static_cast<std::array<double, 3>>(proxy2);
+        }
+
+        friend bool operator!=(VectorProxy const& proxy1, VectorProxy const& proxy2)
+        {
+            return !(proxy1 == proxy2);
+        }
+
+        friend bool operator==(VectorProxy const& proxy, std::array<double, 3> const& vector)
+        {
+            return static_cast<std::array<double, 3>>(proxy) == vector;
+        }
+
+        friend bool operator==(std::array<double, 3> const& vector, VectorProxy const& proxy)
+        {
+            return proxy == vector;
+        }
+
+        friend bool operator!=(VectorProxy const& proxy, std::array<double, 3> const& vector)
+        {
+            return !(proxy == vector);
+        }
+
+        friend bool operator!=(std::array<double, 3> const& vector, VectorProxy const& proxy)
+        {
+            return !(proxy == vector);
+        }
+
+
+    private:
+        template<typename Vector>
+        VectorProxy const& assign_(Vector const& vector) const
+        {
+            static_assert(!isConst, "error - cannot assign to a const particle");
+            *components[0] = vector[0];
+            *components[1] = vector[1];
+            *components[2] = vector[2];
+            return *this;
+        }
+    };
+
+
+
+    /** @brief ParticleProxy is what one gets when dereferencing an iterator on a
+     * SoAParticleArray. It holds references on the attributes of one particle, which
+     * are stored in separate contiguous arrays, so that client code can use it like it
+     * would use a Particle (part.iCell[0], part.v[1], part.Ex etc.).
+     *
+     * Copying a ParticleProxy copies the references, not the particle. To get an
+     * independant copy of the particle one has to explicitly convert it to a Particle<dim>.
+     * Assigning to a ParticleProxy assigns the values of the referenced particle.
+     */
+    template<std::size_t dim, bool isConst>
+    struct ParticleProxy
+    {
+        template<typename T>
+        using ref_t = std::conditional_t<isConst, T const&, T&>;
+
+        static const std::size_t dimension = dim;
+
+        ref_t<double> weight;
+        ref_t<double> charge;
+
+        ref_t<std::array<int, dim>> iCell;
+        ref_t<std::array<float, dim>> delta;
+        VectorProxy<isConst> v;
+
+        ref_t<double> Ex, Ey, Ez;
+        ref_t<double> Bx, By, Bz;
+
+
+        ParticleProxy(ParticleProxy const&) = default;
+
+
+        ParticleProxy const& operator=(ParticleProxy const& other) const
+        {
+            return assign_(other);
+        }
+
+        template<bool otherIsConst>
+        ParticleProxy const& operator=(ParticleProxy<dim, otherIsConst> const& other) const
+        {
+            return assign_(other);
+        }
+
+        ParticleProxy const& operator=(Particle<dim> const& particle) const
+        {
+            return assign_(particle);
+        }
+
+
+        operator Particle<dim>() const
+        {
+            return {weight, charge, iCell, delta, v, Ex, Ey, Ez, Bx, By, Bz};
+        }
+
+
+    private:
+        template<typename ParticleLike>
+        ParticleProxy const& assign_(ParticleLike const& other) const
+        {
+            static_assert(!isConst, "error - cannot assign to a const particle");
+            weight = other.weight;
+            charge = other.charge;
+            iCell  = other.iCell;
+            delta  = other.delta;
+            v      = other.v;
+            Ex     = other.Ex;
+            Ey     = other.Ey;
+            Ez     = other.Ez;
+            Bx     = other.Bx;
+            By     = other.By;
+            Bz     = other.Bz;
+            return *this;
+        }
+    };
+
+
+
+    //! swap the values of the two particles referenced by the proxies
+    template<std::size_t dim>
+    void swap(ParticleProxy<dim, false> particle1, ParticleProxy<dim, false> particle2)
+    {
+        Particle<dim> tmp = particle1;
+        particle1         = particle2;
+        particle2         = tmp;
+    }
+
+
+
+
+    /** @brief random access iterator on a SoAParticleArray. Dereferencing returns
+     * a ParticleProxy on the particle at the current index.
+     */
+    template<std::size_t dim, bool isConst>
+    class SoAParticleIterator
+    {
+        using array_type
+            = std::conditional_t<isConst, SoAParticleArray<dim> const, SoAParticleArray<dim>>;
+
+    public:
+        // operator-> needs to return something with an operator->, and a proxy is not
+        // an lvalue we can take the address of, so we keep it in this small holder
+        struct ArrowProxy
+        {
+            ParticleProxy<dim, isConst> proxy;
+            ParticleProxy<dim, isConst> const* operator->() const { return &proxy; }
+        };
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = Particle<dim>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = ParticleProxy<dim, isConst>;
+        using pointer           = ArrowProxy;
+
+
+        SoAParticleIterator() = default;
+
+        SoAParticleIterator(array_type* array, difference_type index)
+            : array_{array}
+            , index_{index}
+        {
+        }
+
+        // allows iterator -> const_iterator conversion
+        template<bool otherIsConst, typename = std::enable_if_t<isConst && !otherIsConst>>
+        SoAParticleIterator(SoAParticleIterator<dim, otherIsConst> const& other)
+            : array_{other.array_}
+            , index_{other.index_}
+        {
+        }
+
+
+        reference operator*() const { return (*array_)[static_cast<std::size_t>(index_)]; }
+        pointer operator->() const { return ArrowProxy{**this}; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+
+        SoAParticleIterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        SoAParticleIterator operator++(int)
+        {
+            auto copy{*this};
+            ++index_;
+            return copy;
+        }
+
+        SoAParticleIterator& operator--()
+        {
+            --index_;
+            return *this;
+        }
+
+        SoAParticleIterator operator--(int)
+        {
+            auto copy{*this};
+            --index_;
+            return copy;
+        }
+
+        SoAParticleIterator& operator+=(difference_type n)
+        {
+            index_ += n;
+            return *this;
+        }
+
+        SoAParticleIterator& operator-=(difference_type n)
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        SoAParticleIterator operator+(difference_type n) const
+        {
+            return SoAParticleIterator{array_, index_ + n};
+        }
+
+        friend SoAParticleIterator operator+(difference_type n, SoAParticleIterator const& it)
+        {
+            return it + n;
+        }
+
+        SoAParticleIterator operator-(difference_type n) const
+        {
+            return SoAParticleIterator{array_, index_ - n};
+        }
+
+        difference_type operator-(SoAParticleIterator const& other) const
+        {
+            return index_ - other.index_;
+        }
+
+        bool operator==(SoAParticleIterator const& other) const
+        {
+            return array_ == other.array_ && index_ == other.index_;
+        }
+
+        bool operator!=(SoAParticleIterator const& other) const { return !(*this == other); }
+        bool operator<(SoAParticleIterator const& other) const { return index_ < other.index_; }
+        bool operator>(SoAParticleIterator const& other) const { return index_ > other.index_; }
+        bool operator<=(SoAParticleIterator const& other) const { return index_ <= other.index_; }
+        bool operator>=(SoAParticleIterator const& other) const { return index_ >= other.index_; }
+
+
+        //! index of the particle pointed by the iterator, in its array
+        difference_type index() const { return index_; }
+
+
+    private:
+        array_type* array_{nullptr};
+        difference_type index_{0};
+
+        template<std::size_t, bool>
+        friend class SoAParticleIterator;
+    };
+
+
+
+
+    /** @brief SoAParticleArray stores particles as a structure of arrays, i.e. each attribute
+     * (weight, charge, iCell, delta, v, E and B) of all particles is stored in its own contiguous
+     * array, and each component of v, E and B in its own array. Kernels that only need a few
+     * attributes of the particles (e.g. the velocity update of the pusher) thus only stream these
+     * through the cache, with unit stride.
+     *
+     * The class exposes the subset of the std::vector interface used on particle arrays in PHARE
+     * and iterators that dereference to ParticleProxy, so that code written for an array of
+     * Particle (see AoSParticleArray) works unchanged with it.
+     *
+     * Raw access to the attribute arrays is given by weight(), charge(), iCell(), delta(),
+     * v(), E() and B() for kernels that want to work on the arrays directly. v(), E() and B()
+     * give the three arrays of the x, y and z components.
+     */
+    template<std::size_t dim>
+    class SoAParticleArray
+    {
+    public:
+        static constexpr std::size_t dimension = dim;
+        using value_type                       = Particle<dim>;
+        using size_type                        = std::size_t;
+        using difference_type                  = std::ptrdiff_t;
+        using reference                        = ParticleProxy<dim, false>;
+        using const_reference                  = ParticleProxy<dim, true>;
+        using iterator                         = SoAParticleIterator<dim, false>;
+        using const_iterator                   = SoAParticleIterator<dim, true>;
+
+
+        SoAParticleArray() = default;
+
+        explicit SoAParticleArray(size_type size) { resize(size); }
+
+        SoAParticleArray(size_type size, Particle<dim> const& particle)
+        {
+            resize(size, particle);
+        }
+
+        template<typename InputIterator>
+        SoAParticleArray(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+        }
+
+
+
+        size_type size() const { return weight_.size(); }
+
+        bool empty() const { return weight_.empty(); }
+
+        size_type capacity() const { return weight_.capacity(); }
+
+        //! bytes allocated by the arrays of all the attributes
+        std::size_t allocatedBytes() const
+        {
+            std::size_t bytes = 0;
+            forEachAttribute_([&bytes](auto const& attribute) {
+                using attribute_type = typename std::decay_t<decltype(attribute)>::value_type;
+                bytes += attribute.capacity() * sizeof(attribute_type);
+            });
+            return bytes;
+        }
+
+
+
+        void reserve(size_type newCapacity)
+        {
+            forEachAttribute_([newCapacity](auto& attribute) { attribute.reserve(newCapacity); });
+        }
+
+
+        void resize(size_type newSize) { resize(newSize, Particle<dim>{}); }
+
+
+        void resize(size_type newSize, Particle<dim> const& particle)
+        {
+            weight_.resize(newSize, particle.weight);
+            charge_.resize(newSize, particle.charge);
+            iCell_.resize(newSize, particle.iCell);
+            delta_.resize(newSize, particle.delta);
+            forEachComponent_(particle, [newSize](auto& component, double value) {
+                component.resize(newSize, value);
+            });
+        }
+
+
+        void clear()
+        {
+            forEachAttribute_([](auto& attribute) { attribute.clear(); });
+        }
+
+
+        void push_back(Particle<dim> const& particle)
+        {
+            weight_.push_back(particle.weight);
+            charge_.push_back(particle.charge);
+            iCell_.push_back(particle.iCell);
+            delta_.push_back(particle.delta);
+            forEachComponent_(particle,
+                              [](auto& component, double value) { component.push_back(value); });
+        }
+
+
+        void pop_back()
+        {
+            forEachAttribute_([](auto& attribute) { attribute.pop_back(); });
+        }
+
+
+        /** erase particles in [first, last[, particles after last are moved so that
+         * they keep their relative order, like std::vector::erase
+         */
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto iFirst = first.index();
+            auto iLast  = last.index();
+            forEachAttribute_([iFirst, iLast](auto& attribute) {
+                attribute.erase(std::begin(attribute) + iFirst, std::begin(attribute) + iLast);
+            });
+            return iterator{this, iFirst};
+        }
+
+
+        void swap(SoAParticleArray& other)
+        {
+            weight_.swap(other.weight_);
+            charge_.swap(other.charge_);
+            iCell_.swap(other.iCell_);
+            delta_.swap(other.delta_);
+            v_.swap(other.v_);
+            E_.swap(other.E_);
+            B_.swap(other.B_);
+        }
+
+
+
+        reference operator[](size_type i)
+        {
+            return {weight_[i], charge_[i], iCell_[i], delta_[i], vectorAt_(v_, i), E_[0][i],
+                    E_[1][i],   E_[2][i],   B_[0][i],  B_[1][i],  B_[2][i]};
+        }
+
+        const_reference operator[](size_type i) const
+        {
+            return {weight_[i], charge_[i], iCell_[i], delta_[i], vectorAt_(v_, i), E_[0][i],
+                    E_[1][i],   E_[2][i],   B_[0][i],  B_[1][i],  B_[2][i]};
+        }
+
+        reference back() { return (*this)[size() - 1]; }
+        const_reference back() const { return (*this)[size() - 1]; }
+
+
+
+        iterator begin() { return iterator{this, 0}; }
+        iterator end() { return iterator{this, static_cast<difference_type>(size())}; }
+
+        const_iterator begin() const { return const_iterator{this, 0}; }
+        const_iterator end() const
+        {
+            return const_iterator{this, static_cast<difference_type>(size())};
+        }
+
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+
+
+        auto& weight() { return weight_; }
+        auto& charge() { return charge_; }
+        auto& iCell() { return iCell_; }
+        auto& delta() { return delta_; }
+        auto& v() { return v_; }
+        auto& E() { return E_; }
+        auto& B() { return B_; }
+
+        auto const& weight() const { return weight_; }
+        auto const& charge() const { return charge_; }
+        auto const& iCell() const { return iCell_; }
+        auto const& delta() const { return delta_; }
+        auto const& v() const { return v_; }
+        auto const& E() const { return E_; }
+        auto const& B() const { return B_; }
+
+
+
+    private:
+        template<typename Fn>
+        void forEachAttribute_(Fn&& fn)
+        {
+            forEachAttributeOf_(*this, fn);
+        }
+
+        template<typename Fn>
+        void forEachAttribute_(Fn&& fn) const
+        {
+            forEachAttributeOf_(*this, fn);
+        }
+
+        template<typename Array, typename Fn>
+        static void forEachAttributeOf_(Array& particles, Fn& fn)
+        {
+            fn(particles.weight_);
+            fn(particles.charge_);
+            fn(particles.iCell_);
+            fn(particles.delta_);
+            for (auto component = 0u; component < 3; ++component)
+            {
+                fn(particles.v_[component]);
+                fn(particles.E_[component]);
+                fn(particles.B_[component]);
+            }
+        }
+
+
+        //! calls fn(componentArray, value) for each component of v, E and B of the particle
+        template<typename Fn>
+        void forEachComponent_(Particle<dim> const& particle, Fn&& fn)
+        {
+            fn(v_[0], particle.v[0]);
+            fn(v_[1], particle.v[1]);
+            fn(v_[2], particle.v[2]);
+            fn(E_[0], particle.Ex);
+            fn(E_[1], particle.Ey);
+            fn(E_[2], particle.Ez);
+            fn(B_[0], particle.Bx);
+            fn(B_[1], particle.By);
+            fn(B_[2], particle.Bz);
+        }
+
+
+        static VectorProxy<false> vectorAt_(std::array<std::vector<double>, 3>& vector,
+                                            size_type i)
+        {
+            return {{{&vector[0][i], &vector[1][i], &vector[2][i]}}};
+        }
+
+        static VectorProxy<true> vectorAt_(std::array<std::vector<double>, 3> const& vector,
+                                           size_type i)
+        {
+            return {{{&vector[0][i], &vector[1][i], &vector[2][i]}}};
+        }
+
+
+        std::vector<double> weight_;
+        std::vector<double> charge_;
+        std::vector<std::array<int, dim>> iCell_;
+        std::vector<std::array<float, dim>> delta_;
+        std::array<std::vector<double>, 3> v_;
+        std::array<std::vector<double>, 3> E_;
+        std::array<std::vector<double>, 3> B_;
+    };
+
+
+} // namespace core
+} // namespace PHARE
+
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef PHARE_CORE_DATA_PARTICLES_PARTICLE_WIRE_FORMAT_H
+#define PHARE_CORE_DATA_PARTICLES_PARTICLE_WIRE_FORMAT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "data/particles/particle.h"
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief ParticleWireFormat is the compact serialization of particles exchanged between
+     * patches.
+     *
+     * Only the particle state is serialized: weight, charge, iCell, delta and v. The electric
+     * and magnetic fields at the particle position are not, since the receiver interpolates
+     * them again before using them. iCell is written relative to an origin cell known by
+     * both the sender and the receiver (typically the lower cell of an overlap box) as
+     * unsigned 16 bits integers. Fields are written one after the other without padding.
+     *
+     * A particle thus takes particleSize bytes, about half the size of a Particle<dim>.
+     */
+    template<std::size_t dim>
+    class ParticleWireFormat
+    {
+    public:
+        using cell_type = std::uint16_t;
+
+        static constexpr std::size_t particleSize = 2 * sizeof(double) + dim * sizeof(cell_type)
+                                                    + dim * sizeof(float) + 3 * sizeof(double);
+
+
+        //! @return the number of bytes needed to serialize nbrParticles particles
+        static constexpr std::size_t bufferSize(std::size_t nbrParticles)
+        {
+            return nbrParticles * particleSize;
+        }
+
+
+
+        /** writes the particle at out, which must point to at least particleSize bytes.
+         * The Particle type can be a Particle<dim> or a particle proxy of a SoA array.
+         * @return the position following the written particle
+         */
+        template<typename Particle>
+        static char* write(Particle const& particle, std::array<int, dim> const& origin, char* out)
+        {
+            out = write_(out, static_cast<double>(particle.weight));
+            out = write_(out, static_cast<double>(particle.charge));
+
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                auto relativeCell = particle.iCell[iDim] - origin[iDim];
+                if (relativeCell < 0 || relativeCell > std::numeric_limits<cell_type>::max())
+                {
+                    throw std::runtime_error(
+                        "Error - particle cell does not fit in the particle wire format");
+                }
+                out = write_(out, static_cast<cell_type>(relativeCell));
+            }
+
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                out = write_(out, static_cast<float>(particle.delta[iDim]));
+            }
+
+            for (auto iComp = 0u; iComp < 3; ++iComp)
+            {
+                out = write_(out, static_cast<double>(particle.v[iComp]));
+            }
+
+            return out;
+        }
+
+
+
+        /** reads the particle at in, written with the same origin. Its fields are set to zero.
+         * @return the position following the read particle
+         */
+        static char const* read(char const* in, std::array<int, dim> const& origin,
+                                Particle<dim>& particle)
+        {
+            particle = Particle<dim>{};
+
+            in = read_(in, particle.weight);
+            in = read_(in, particle.charge);
+
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                cell_type relativeCell;
+                in                   = read_(in, relativeCell);
+                particle.iCell[iDim] = origin[iDim] + static_cast<int>(relativeCell);
+            }
+
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                in = read_(in, particle.delta[iDim]);
+            }
+
+            for (auto iComp = 0u; iComp < 3; ++iComp)
+            {
+                in = read_(in, particle.v[iComp]);
+            }
+
+            return in;
+        }
+
+
+
+        //! appends the serialized particle to the buffer
+        template<typename Particle>
+        static void append(Particle const& particle, std::array<int, dim> const& origin,
+                           std::vector<char>& buffer)
+        {
+            auto size = buffer.size();
+            buffer.resize(size + particleSize);
+            write(particle, origin, buffer.data() + size);
+        }
+
+
+
+    private:
+        template<typename T>
+        static char* write_(char* out, T value)
+        {
+            std::memcpy(out, &value, sizeof(T));
+            return out + sizeof(T);
+        }
+
+        template<typename T>
+        static char const* read_(char const* in, T& value)
+        {
+            std::memcpy(&value, in, sizeof(T));
+            return in + sizeof(T);
+        }
+    };
+
+
+} // namespace core
+} // namespace PHARE
+
+#endif
@@ -25,7 +25,7 @@ namespace core
     {
     public:
         VecField()                                 = delete;
-        VecField& Vecfield(VecField const& source) = delete;
+        VecField(VecField const& source)           = default;
         VecField(VecField&& source)                = default;
         VecField& operator=(VecField const& source) = delete;
         VecField& operator=(VecField&& source) = default;
@@ -84,6 +84,18 @@ namespace core
             }
         }
 
+        //! sets the buffer at the given index of getFieldNamesAndQuantities()
+        void setBuffer(std::size_t index, field_type* field)
+        {
+            switch (index)
+            {
+                case 0: xComponent_ = field; break;
+                case 1: yComponent_ = field; break;
+                case 2: zComponent_ = field; break;
+                default: throw std::runtime_error("Error - invalid VecField buffer index");
+            }
+        }
+
         //! return true if the VecField can be used to access component data
         bool isUsable() const
         {
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <iostream>
+#include <limits>
 
 #include "data/grid/gridlayoutdefs.h"
 #include "data/vecfield/vecfield_component.h"
@@ -17,6 +18,9 @@ namespace core
      * This implementation is used by the Ampere object to calculate the current density J.
      * It is templated by the layout and the dimension so specialized template actually do the job
      *
+     * Only the nodes of J whose X index is in [xLower, xUpper] are computed, so that the
+     * FusedFieldSolver can sweep a patch by slabs. The operator object passes the whole range.
+     *
      */
     template<typename GridLayout, std::size_t dim>
     class AmpereImpl
@@ -73,7 +77,7 @@ namespace core
 
     public:
         template<typename VecField>
-        void operator()(VecField const& B, VecField& J)
+        void operator()(VecField const& B, VecField& J, uint32 xLower, uint32 xUpper)
         {
             // auto &Jx = J.getComponent(Component::X); // =  0
             auto& Jy = J.getComponent(Component::Y); // = -dxBz
@@ -83,23 +87,13 @@ namespace core
             auto const& By = B.getComponent(Component::Y);
             auto const& Bz = B.getComponent(Component::Z);
 
-            // TODO Direction should not be in gridlayoutdef but in utilities somehow
-            // TODO 1st arg of physicalStartIndex( could be QtyCentering::primal ?
-            auto start = this->layout_->physicalStartIndex(Jy, Direction::X);
-            auto end   = this->layout_->physicalEndIndex(Jy, Direction::X);
+            auto const& layout = *this->layout_;
 
-            for (auto ix = start; ix <= end; ++ix)
-            {
-                Jy(ix) = -this->layout_->deriv(Bz, {ix}, DirectionTag<Direction::X>{});
-            }
+            layout.deriv(Bz, xWindow(layout.physicalBox(Jy), xLower, xUpper), Jy,
+                         DirectionTag<Direction::X>{}, -1.);
 
-            start = this->layout_->physicalStartIndex(Jz, Direction::X);
-            end   = this->layout_->physicalEndIndex(Jz, Direction::X);
-
-            for (auto ix = start; ix <= end; ++ix)
-            {
-                Jz(ix) = this->layout_->deriv(By, {ix}, DirectionTag<Direction::X>{});
-            }
+            layout.deriv(By, xWindow(layout.physicalBox(Jz), xLower, xUpper), Jz,
+                         DirectionTag<Direction::X>{});
         }
     };
 
@@ -113,7 +107,7 @@ namespace core
 
     public:
         template<typename VecField>
-        void operator()(VecField const& B, VecField& J)
+        void operator()(VecField const& B, VecField& J, uint32 xLower, uint32 xUpper)
         {
             auto& Jx = J.getComponent(Component::X); // =  dyBz
             auto& Jy = J.getComponent(Component::Y); // = -dxBz
@@ -123,45 +117,17 @@ namespace core
             auto const& By = B.getComponent(Component::Y);
             auto const& Bz = B.getComponent(Component::Z);
 
-            auto psi_X = this->layout_->physicalStartIndex(Jx, Direction::X);
-            auto pei_X = this->layout_->physicalEndIndex(Jx, Direction::X);
-            auto psi_Y = this->layout_->physicalStartIndex(Jx, Direction::Y);
-            auto pei_Y = this->layout_->physicalEndIndex(Jx, Direction::Y);
-
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    Jx(ix, iy) = this->layout_->deriv(Bz, {ix, iy}, DirectionTag<Direction::Y>{});
-                }
-            }
+            auto const& layout = *this->layout_;
 
-            psi_X = this->layout_->physicalStartIndex(Jy, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Jy, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Jy, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Jy, Direction::Y);
+            layout.deriv(Bz, xWindow(layout.physicalBox(Jx), xLower, xUpper), Jx,
+                         DirectionTag<Direction::Y>{});
 
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    Jy(ix, iy) = -this->layout_->deriv(Bz, {ix, iy}, DirectionTag<Direction::X>{});
-                }
-            }
+            layout.deriv(Bz, xWindow(layout.physicalBox(Jy), xLower, xUpper), Jy,
+                         DirectionTag<Direction::X>{}, -1.);
 
-            psi_X = this->layout_->physicalStartIndex(Jz, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Jz, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Jz, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Jz, Direction::Y);
-
-            for (uint32 ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (uint32 iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    Jz(ix, iy) = this->layout_->deriv(By, {ix, iy}, DirectionTag<Direction::X>{})
-                                 - this->layout_->deriv(Bx, {ix, iy}, DirectionTag<Direction::Y>{});
-                }
-            }
+            auto JzBox = xWindow(layout.physicalBox(Jz), xLower, xUpper);
+            layout.deriv(By, JzBox, Jz, DirectionTag<Direction::X>{});
+            layout.addDeriv(Bx, JzBox, Jz, Jz, DirectionTag<Direction::Y>{}, -1.);
         }
     };
 
@@ -175,9 +141,9 @@ namespace core
 
     public:
         template<typename VecField>
-        void operator()(VecField const& B, VecField& J)
+        void operator()(VecField const& B, VecField& J, uint32 xLower, uint32 xUpper)
         {
-            auto& Jx = J.getComponent(Component::X); // =  dyBz - dzBx
+            auto& Jx = J.getComponent(Component::X); // =  dyBz - dzBy
             auto& Jy = J.getComponent(Component::Y); // =  dzBx - dxBz
             auto& Jz = J.getComponent(Component::Z); // =  dxBy - dyBx
 
@@ -185,68 +151,19 @@ namespace core
             auto const& By = B.getComponent(Component::Y);
             auto const& Bz = B.getComponent(Component::Z);
 
-            auto psi_X = this->layout_->physicalStartIndex(Jx, Direction::X);
-            auto pei_X = this->layout_->physicalEndIndex(Jx, Direction::X);
-            auto psi_Y = this->layout_->physicalStartIndex(Jx, Direction::Y);
-            auto pei_Y = this->layout_->physicalEndIndex(Jx, Direction::Y);
-            auto psi_Z = this->layout_->physicalStartIndex(Jx, Direction::Z);
-            auto pei_Z = this->layout_->physicalEndIndex(Jx, Direction::Z);
-
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    for (auto iz = psi_Z; iz <= pei_Z; ++iz)
-                    {
-                        Jx(ix, iy, iz)
-                            = this->layout_->deriv(Bz, {ix, iy, iz}, DirectionTag<Direction::Y>{})
-                              - this->layout_->deriv(By, {ix, iy, iz},
-                                                     DirectionTag<Direction::Z>{});
-                    }
-                }
-            }
-
-            psi_X = this->layout_->physicalStartIndex(Jy, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Jy, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Jy, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Jy, Direction::Y);
-            psi_Z = this->layout_->physicalStartIndex(Jy, Direction::Z);
-            pei_Z = this->layout_->physicalEndIndex(Jy, Direction::Z);
+            auto const& layout = *this->layout_;
 
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    for (auto iz = psi_Z; iz <= pei_Z; ++iz)
-                    {
-                        Jy(ix, iy, iz)
-                            = this->layout_->deriv(Bx, {ix, iy, iz}, DirectionTag<Direction::Z>{})
-                              - this->layout_->deriv(Bz, {ix, iy, iz},
-                                                     DirectionTag<Direction::X>{});
-                    }
-                }
-            }
+            auto JxBox = xWindow(layout.physicalBox(Jx), xLower, xUpper);
+            layout.deriv(Bz, JxBox, Jx, DirectionTag<Direction::Y>{});
+            layout.addDeriv(By, JxBox, Jx, Jx, DirectionTag<Direction::Z>{}, -1.);
 
-            psi_X = this->layout_->physicalStartIndex(Jz, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Jz, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Jz, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Jz, Direction::Y);
-            psi_Z = this->layout_->physicalStartIndex(Jz, Direction::Z);
-            pei_Z = this->layout_->physicalEndIndex(Jz, Direction::Z);
+            auto JyBox = xWindow(layout.physicalBox(Jy), xLower, xUpper);
+            layout.deriv(Bx, JyBox, Jy, DirectionTag<Direction::Z>{});
+            layout.addDeriv(Bz, JyBox, Jy, Jy, DirectionTag<Direction::X>{}, -1.);
 
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    for (auto iz = psi_Z; iz <= pei_Z; ++iz)
-                    {
-                        Jz(ix, iy, iz)
-                            = this->layout_->deriv(By, {ix, iy, iz}, DirectionTag<Direction::X>{})
-                              - this->layout_->deriv(Bx, {ix, iy, iz},
-                                                     DirectionTag<Direction::Y>{});
-                    }
-                }
-            }
+            auto JzBox = xWindow(layout.physicalBox(Jz), xLower, xUpper);
+            layout.deriv(By, JzBox, Jz, DirectionTag<Direction::X>{});
+            layout.addDeriv(Bx, JzBox, Jz, Jz, DirectionTag<Direction::Y>{}, -1.);
         }
     };
 
@@ -268,9 +185,8 @@ namespace core
                 throw std::runtime_error(
                     "Error - Ampere - GridLayout not set, cannot proceed to calculate ampere()");
             }
-            std::cout << "I'm solving ampere " << GridLayout::dimension << "\n";
 
-            impl_(B, J);
+            impl_(B, J, 0, std::numeric_limits<uint32>::max());
         }
 
 
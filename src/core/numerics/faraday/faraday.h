@@ -1,8 +1,9 @@
-#ifndef PHARE_CORE_NUMERICS_AMPERE_AMPERE_H
-#define PHARE_CORE_NUMERICS_AMPERE_AMPERE_H
+#ifndef PHARE_CORE_NUMERICS_FARADAY_FARADAY_H
+#define PHARE_CORE_NUMERICS_FARADAY_FARADAY_H
 
 #include <cstddef>
 #include <iostream>
+#include <limits>
 
 #include "data/grid/gridlayoutdefs.h"
 #include "data/vecfield/vecfield_component.h"
@@ -17,6 +18,9 @@ namespace core
      * This implementation is used by the Faraday object to calculate the magentic field
      * It is templated by the layout and the dimension so specialized template actually do the job
      *
+     * Only the nodes of Bnew whose X index is in [xLower, xUpper] are computed, so that the
+     * FusedFieldSolver can sweep a patch by slabs. The operator object passes the whole range.
+     *
      */
     template<typename GridLayout, std::size_t dim>
     class FaradayImpl
@@ -74,44 +78,30 @@ namespace core
 
     public:
         template<typename VecField>
-        void operator()(VecField const& B, VecField const& E, VecField& Bnew)
+        void operator()(VecField const& B, VecField const& E, VecField& Bnew, uint32 xLower,
+                        uint32 xUpper)
         {
             // dBxdt =  0
             // dBydt =  dxEz
             // dBzdt = -dxEy
 
-            auto const& Bx = B.getComponent(Component::X);
             auto const& By = B.getComponent(Component::Y);
             auto const& Bz = B.getComponent(Component::Z);
 
-            auto const& Ex = E.getComponent(Component::X);
             auto const& Ey = E.getComponent(Component::Y);
             auto const& Ez = E.getComponent(Component::Z);
 
-            auto& Bxnew = Bnew.getComponent(Component::X);
             auto& Bynew = Bnew.getComponent(Component::Y);
             auto& Bznew = Bnew.getComponent(Component::Z);
 
-            // Direction should not be in gridlayoutdef but in utilities somehow
-            auto start = this->layout_->physicalStartIndex(Bynew, Direction::X);
-            auto end   = this->layout_->physicalEndIndex(Bynew, Direction::X);
-
-            for (auto ix = start; ix <= end; ++ix)
-            {
-                Bynew(ix)
-                    = By(ix)
-                      + this->dt_ * this->layout_->deriv(Ez, {ix}, DirectionTag<Direction::X>{});
-            }
+            auto const& layout = *this->layout_;
+            auto const dt      = this->dt_;
 
-            start = this->layout_->physicalStartIndex(Bznew, Direction::X);
-            end   = this->layout_->physicalEndIndex(Bznew, Direction::X);
+            layout.addDeriv(Ez, xWindow(layout.physicalBox(Bynew), xLower, xUpper), By, Bynew,
+                            DirectionTag<Direction::X>{}, dt);
 
-            for (auto ix = start; ix <= end; ++ix)
-            {
-                Bznew(ix)
-                    = Bz(ix)
-                      - this->dt_ * this->layout_->deriv(Ey, {ix}, DirectionTag<Direction::X>{});
-            }
+            layout.addDeriv(Ey, xWindow(layout.physicalBox(Bznew), xLower, xUpper), Bz, Bznew,
+                            DirectionTag<Direction::X>{}, -dt);
         }
     };
 
@@ -125,7 +115,8 @@ namespace core
 
     public:
         template<typename VecField>
-        void operator()(VecField const& B, VecField const& E, VecField& Bnew)
+        void operator()(VecField const& B, VecField const& E, VecField& Bnew, uint32 xLower,
+                        uint32 xUpper)
         {
             // dBxdt =  -dyEz
             // dBydt =  dxEz
@@ -143,55 +134,18 @@ namespace core
             auto& Bynew = Bnew.getComponent(Component::Y);
             auto& Bznew = Bnew.getComponent(Component::Z);
 
-            auto psi_X = this->layout_->physicalStartIndex(Bxnew, Direction::X);
-            auto pei_X = this->layout_->physicalEndIndex(Bxnew, Direction::X);
-            auto psi_Y = this->layout_->physicalStartIndex(Bxnew, Direction::Y);
-            auto pei_Y = this->layout_->physicalEndIndex(Bxnew, Direction::Y);
-
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    Bxnew(ix, iy)
-                        = Bx(ix, iy)
-                          - this->dt_
-                                * this->layout_->deriv(Ez, {ix, iy}, DirectionTag<Direction::Y>{});
-                }
-            }
-
-            psi_X = this->layout_->physicalStartIndex(Bynew, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Bynew, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Bynew, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Bynew, Direction::Y);
+            auto const& layout = *this->layout_;
+            auto const dt      = this->dt_;
 
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    Bynew(ix, iy)
-                        = By(ix, iy)
-                          + this->dt_
-                                * this->layout_->deriv(Ez, {ix, iy}, DirectionTag<Direction::X>{});
-                }
-            }
+            layout.addDeriv(Ez, xWindow(layout.physicalBox(Bxnew), xLower, xUpper), Bx, Bxnew,
+                            DirectionTag<Direction::Y>{}, -dt);
 
-            psi_X = this->layout_->physicalStartIndex(Bznew, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Bznew, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Bznew, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Bznew, Direction::Y);
+            layout.addDeriv(Ez, xWindow(layout.physicalBox(Bynew), xLower, xUpper), By, Bynew,
+                            DirectionTag<Direction::X>{}, dt);
 
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    Bznew(ix, iy)
-                        = Bz(ix, iy)
-                          - this->dt_
-                                * this->layout_->deriv(Ey, {ix, iy}, DirectionTag<Direction::X>{})
-                          + this->dt_
-                                * this->layout_->deriv(Ex, {ix, iy}, DirectionTag<Direction::Y>{});
-                }
-            }
+            auto BzBox = xWindow(layout.physicalBox(Bznew), xLower, xUpper);
+            layout.addDeriv(Ey, BzBox, Bz, Bznew, DirectionTag<Direction::X>{}, -dt);
+            layout.addDeriv(Ex, BzBox, Bznew, Bznew, DirectionTag<Direction::Y>{}, dt);
         }
     };
 
@@ -205,7 +159,8 @@ namespace core
 
     public:
         template<typename VecField>
-        void operator()(VecField const& B, VecField const& E, VecField& Bnew)
+        void operator()(VecField const& B, VecField const& E, VecField& Bnew, uint32 xLower,
+                        uint32 xUpper)
         {
             // dBxdt = -dyEz + dzEy
             // dBydt = -dzEx + dxEz
@@ -223,80 +178,20 @@ namespace core
             auto& Bynew = Bnew.getComponent(Component::Y);
             auto& Bznew = Bnew.getComponent(Component::Z);
 
-            auto psi_X = this->layout_->physicalStartIndex(Bxnew, Direction::X);
-            auto pei_X = this->layout_->physicalEndIndex(Bxnew, Direction::X);
-            auto psi_Y = this->layout_->physicalStartIndex(Bxnew, Direction::Y);
-            auto pei_Y = this->layout_->physicalEndIndex(Bxnew, Direction::Y);
-            auto psi_Z = this->layout_->physicalStartIndex(Bxnew, Direction::Z);
-            auto pei_Z = this->layout_->physicalEndIndex(Bxnew, Direction::Z);
-
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    for (auto iz = psi_Z; iz <= pei_Z; ++iz)
-                    {
-                        Bxnew(ix, iy, iz)
-                            = Bx(ix, iy, iz)
-                              - this->dt_
-                                    * this->layout_->deriv(Ez, {ix, iy, iz},
-                                                           DirectionTag<Direction::Y>{})
-                              + this->dt_
-                                    * this->layout_->deriv(Ey, {ix, iy, iz},
-                                                           DirectionTag<Direction::Z>{});
-                    }
-                }
-            }
+            auto const& layout = *this->layout_;
+            auto const dt      = this->dt_;
 
-            psi_X = this->layout_->physicalStartIndex(Bynew, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Bynew, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Bynew, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Bynew, Direction::Y);
-            psi_Z = this->layout_->physicalStartIndex(Bynew, Direction::Z);
-            pei_Z = this->layout_->physicalEndIndex(Bynew, Direction::Z);
+            auto BxBox = xWindow(layout.physicalBox(Bxnew), xLower, xUpper);
+            layout.addDeriv(Ez, BxBox, Bx, Bxnew, DirectionTag<Direction::Y>{}, -dt);
+            layout.addDeriv(Ey, BxBox, Bxnew, Bxnew, DirectionTag<Direction::Z>{}, dt);
 
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    for (auto iz = psi_Z; iz <= pei_Z; ++iz)
-                    {
-                        Bynew(ix, iy, iz)
-                            = By(ix, iy, iz)
-                              - this->dt_
-                                    * this->layout_->deriv(Ex, {ix, iy, iz},
-                                                           DirectionTag<Direction::Z>{})
-                              + this->dt_
-                                    * this->layout_->deriv(Ez, {ix, iy, iz},
-                                                           DirectionTag<Direction::X>{});
-                    }
-                }
-            }
+            auto ByBox = xWindow(layout.physicalBox(Bynew), xLower, xUpper);
+            layout.addDeriv(Ex, ByBox, By, Bynew, DirectionTag<Direction::Z>{}, -dt);
+            layout.addDeriv(Ez, ByBox, Bynew, Bynew, DirectionTag<Direction::X>{}, dt);
 
-            psi_X = this->layout_->physicalStartIndex(Bznew, Direction::X);
-            pei_X = this->layout_->physicalEndIndex(Bznew, Direction::X);
-            psi_Y = this->layout_->physicalStartIndex(Bznew, Direction::Y);
-            pei_Y = this->layout_->physicalEndIndex(Bznew, Direction::Y);
-            psi_Z = this->layout_->physicalStartIndex(Bznew, Direction::Z);
-            pei_Z = this->layout_->physicalEndIndex(Bznew, Direction::Z);
-
-            for (auto ix = psi_X; ix <= pei_X; ++ix)
-            {
-                for (auto iy = psi_Y; iy <= pei_Y; ++iy)
-                {
-                    for (auto iz = psi_Z; iz <= pei_Z; ++iz)
-                    {
-                        Bznew(ix, iy, iz)
-                            = Bz(ix, iy, iz)
-                              - this->dt_
-                                    * this->layout_->deriv(Ey, {ix, iy, iz},
-                                                           DirectionTag<Direction::X>{})
-                              + this->dt_
-                                    * this->layout_->deriv(Ex, {ix, iy, iz},
-                                                           DirectionTag<Direction::Y>{});
-                    }
-                }
-            }
+            auto BzBox = xWindow(layout.physicalBox(Bznew), xLower, xUpper);
+            layout.addDeriv(Ey, BzBox, Bz, Bznew, DirectionTag<Direction::X>{}, -dt);
+            layout.addDeriv(Ex, BzBox, Bznew, Bznew, DirectionTag<Direction::Y>{}, dt);
         }
     };
 
@@ -319,7 +214,7 @@ namespace core
                     "Error - Faraday - GridLayout not set, cannot proceed to calculate faraday()");
             }
 
-            impl_(B, E, Bnew);
+            impl_(B, E, Bnew, 0, std::numeric_limits<uint32>::max());
         }
 
 
@@ -0,0 +1,114 @@
+#ifndef PHARE_CORE_NUMERICS_FUSED_FIELD_SOLVER_FUSED_FIELD_SOLVER_H
+#define PHARE_CORE_NUMERICS_FUSED_FIELD_SOLVER_FUSED_FIELD_SOLVER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+#include "data/grid/gridlayoutdefs.h"
+#include "data/vecfield/vecfield_component.h"
+#include "numerics/ampere/ampere.h"
+#include "numerics/faraday/faraday.h"
+#include "numerics/ohm/ohm.h"
+#include "utilities/types.h"
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief FusedFieldSolver computes J = curl(B), then E from Ohm's law and Bnew from Faraday
+     * in a single sweep of the patch, instead of three sweeps by Ampere, Ohm and Faraday.
+     *
+     * The patch is swept along X by slabs of slabWidth nodes. Since all stencils reach at most
+     * one node away, J is computed two slabs ahead of Bnew and E one slab ahead, so that the J
+     * and E a slab needs are still in cache when it is computed. Each node is computed once, by
+     * the same code as the separate operators, so results are identical to calling Ampere, Ohm
+     * and Faraday in turn. Ghost nodes of J and E are read as they are, as in separate calls.
+     */
+    template<typename GridLayout>
+    class FusedFieldSolver
+    {
+    public:
+        explicit FusedFieldSolver(uint32 slabWidth = 8)
+            : slabWidth_{static_cast<int>(slabWidth)}
+        {
+            if (slabWidth == 0)
+            {
+                throw std::runtime_error("Error - FusedFieldSolver - slab width must be > 0");
+            }
+        }
+
+
+        void setLayout(GridLayout* layout)
+        {
+            layout_ = layout;
+            ampere_.setLayout(layout);
+            ohm_.setLayout(layout);
+            faraday_.setLayout(layout);
+        }
+
+
+
+        /** computes J from B, E from n, Ve, Pe, B and J, and Bnew from B and E. Bnew must not
+         * share its components with B.
+         */
+        template<typename Field, typename VecField>
+        void operator()(VecField const& B, Field const& n, VecField const& Ve, Field const& Pe,
+                        VecField& J, VecField& E, VecField& Bnew)
+        {
+            if (layout_ == nullptr)
+            {
+                throw std::runtime_error("Error - FusedFieldSolver - GridLayout not set, cannot "
+                                         "proceed to solve the fields");
+            }
+
+            for (auto component : {Component::X, Component::Y, Component::Z})
+            {
+                if (&B.getComponent(component) == &Bnew.getComponent(component))
+                {
+                    throw std::runtime_error(
+                        "Error - FusedFieldSolver - Bnew cannot share its components with B");
+                }
+            }
+
+            int const xMax
+                = static_cast<int>(layout_->ghostEndIndex(QtyCentering::primal, Direction::X));
+
+            // a slab [first, last] of Bnew needs E on [first - 1, last + 1], which needs J on
+            // [first - 2, last + 2]. Lower nodes have been computed by the previous slabs.
+            for (int first = -2; first <= xMax; first += slabWidth_)
+            {
+                int const last = first + slabWidth_ - 1;
+
+                ampere_(B, J, lower_(first + 2), upper_(last + 2));
+
+                if (last + 1 >= 0)
+                {
+                    ohm_(n, Ve, Pe, B, J, E, lower_(first + 1), upper_(last + 1));
+                }
+
+                if (last >= 0)
+                {
+                    faraday_(B, E, Bnew, lower_(first), upper_(last));
+                }
+            }
+        }
+
+
+
+    private:
+        int slabWidth_;
+        GridLayout* layout_{nullptr};
+        AmpereImpl<GridLayout, GridLayout::dimension> ampere_;
+        OhmImpl<GridLayout, GridLayout::dimension> ohm_;
+        FaradayImpl<GridLayout, GridLayout::dimension> faraday_;
+
+
+        static uint32 lower_(int index) { return static_cast<uint32>(std::max(index, 0)); }
+        static uint32 upper_(int index) { return static_cast<uint32>(index); }
+    };
+
+} // namespace core
+} // namespace PHARE
+
+#endif
@@ -1,8 +1,15 @@
 #ifndef PHARE_CORE_NUMERICS_INTERPOLATOR_INTERPOLATOR_H
 #define PHARE_CORE_NUMERICS_INTERPOLATOR_INTERPOLATOR_H
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "data/grid/gridlayout.h"
 #include "data/vecfield/vecfield_component.h"
@@ -127,38 +134,72 @@ namespace core
 
 
 
-    //! Interpol performs the interpolation of a field using precomputed weights at
-    //! indices starting at startIndex. The class is templated by the Dimensionality
-    template<std::size_t dim>
+    /** \brief StaticCentering gives the centering (primal or dual) of a quantity in each
+     * direction as template parameters. Stencils then know at compile time which of the
+     * primal or dual start indexes and weights they read in each direction.
+     */
+    template<QtyCentering... centerings>
+    struct StaticCentering
+    {
+        static constexpr std::size_t dimension = sizeof...(centerings);
+
+        //! index of the [dual/primal] start indexes and weights to use in each direction
+        static constexpr std::array<std::size_t, dimension> index
+            = {{static_cast<std::size_t>(centering2int(centerings))...}};
+    };
+
+
+
+    template<typename GridLayout, HybridQuantity::Scalar quantity, std::size_t... iDims>
+    constexpr auto makeStaticCentering(std::index_sequence<iDims...>)
+    {
+        return StaticCentering<GridLayout::centering(quantity)[iDims]...>{};
+    }
+
+
+    //! StaticCentering of the given quantity on the layout GridLayout
+    template<typename GridLayout, HybridQuantity::Scalar quantity>
+    using static_centering_t = decltype(makeStaticCentering<GridLayout, quantity>(
+        std::make_index_sequence<GridLayout::dimension>{}));
+
+
+
+
+    //! MeshToParticle interpolates a field at a particle position using precomputed weights
+    //! at indices starting at startIndex. The class is templated by the dimensionality and
+    //! the interpolation order, and its stencils by the centering of the field, so that all
+    //! loop trip counts and the start indexes and weights used are compile-time constants.
+    template<std::size_t dim, std::size_t interpOrder>
     class MeshToParticle
     {
     };
 
 
 
-    /** \brief specialization of Interpol for 1D interpolation
+    /** \brief specialization of MeshToParticle for 1D interpolation
      */
-    template<>
-    class MeshToParticle<1>
+    template<std::size_t interpOrder>
+    class MeshToParticle<1, interpOrder>
     {
     public:
         /** Performs the 1D interpolation
          * \param[in] field is the field from which values are interpolated
-         * \param[in] fieldCentering is the centering (dual or primal) of the field
+         * \param[in] Centering is the StaticCentering (dual or primal) of the field
          * \param[in] startIndex is the first of the nbrPointsSupport indices where to interpolate
          * the field \param[in] weights are the nbrPointsSupport weights used for the interpolation
          */
-        template<typename Field, typename Array1, typename Array2>
-        inline double operator()(Field const& field,
-                                 std::array<QtyCentering, 1> const& fieldCentering,
-                                 Array1 const& startIndex, Array2 const& weights)
+        template<typename Field, typename Centering, typename Array1, typename Array2>
+        inline double operator()(Field const& field, Centering, Array1 const& startIndex,
+                                 Array2 const& weights)
         {
-            auto fieldAtParticle    = 0.;
-            auto const& xStartIndex = startIndex[static_cast<int>(fieldCentering[0])][0];
-            auto const& xWeights    = weights[static_cast<int>(fieldCentering[0])][0];
-            auto order_size         = xWeights.size();
+            static_assert(Centering::dimension == 1, "Error - wrong centering dimension");
+            std::size_t constexpr nbrPoints = nbrPointsSupport(interpOrder);
+
+            auto const xStartIndex = startIndex[Centering::index[0]][0];
+            auto const& xWeights   = weights[Centering::index[0]][0];
 
-            for (auto ik = 0u; ik < order_size; ++ik)
+            double fieldAtParticle = 0.;
+            for (auto ik = 0u; ik < nbrPoints; ++ik)
             {
                 fieldAtParticle += field(xStartIndex + ik) * xWeights[ik];
             }
@@ -167,36 +208,36 @@ namespace core
     };
 
 
-    /**\brief Specialization of Interpol for 2D interpolation
+    /**\brief Specialization of MeshToParticle for 2D interpolation
      */
-    template<>
-    class MeshToParticle<2>
+    template<std::size_t interpOrder>
+    class MeshToParticle<2, interpOrder>
     {
     public:
         /** Performs the 2D interpolation
          * \param[in] field is the field from which values are interpolated
-         * \param[in] fieldCentering is the centering (dual or primal) of the field in each
+         * \param[in] Centering is the StaticCentering (dual or primal) of the field in each
          * direction \param[in] startIndex is the first of the nbrPointsSupport indices where to
          * interpolate the field in both directions \param[in] weights are the nbrPointsSupport
          * weights used for the interpolation in both directions
          */
-
-        template<typename Field, typename Array1, typename Array2>
-        inline double operator()(Field const& field,
-                                 std::array<QtyCentering, 2> const& fieldCentering,
-                                 Array1 const& startIndex, Array2 const& weights)
+        template<typename Field, typename Centering, typename Array1, typename Array2>
+        inline double operator()(Field const& field, Centering, Array1 const& startIndex,
+                                 Array2 const& weights)
         {
-            auto const& xStartIndex = startIndex[static_cast<int>(fieldCentering[0])][0];
-            auto const& yStartIndex = startIndex[static_cast<int>(fieldCentering[1])][1];
-            auto const& xWeights    = weights[static_cast<int>(fieldCentering[0])][0];
-            auto const& yWeights    = weights[static_cast<int>(fieldCentering[1])][1];
+            static_assert(Centering::dimension == 2, "Error - wrong centering dimension");
+            std::size_t constexpr nbrPoints = nbrPointsSupport(interpOrder);
+
+            auto const xStartIndex = startIndex[Centering::index[0]][0];
+            auto const yStartIndex = startIndex[Centering::index[1]][1];
+            auto const& xWeights   = weights[Centering::index[0]][0];
+            auto const& yWeights   = weights[Centering::index[1]][1];
 
-            auto order_size        = xWeights.size();
             double fieldAtParticle = 0.;
-            for (auto ix = 0u; ix < order_size; ++ix)
+            for (auto ix = 0u; ix < nbrPoints; ++ix)
             {
                 double Yinterp = 0.;
-                for (auto iy = 0u; iy < order_size; ++iy)
+                for (auto iy = 0u; iy < nbrPoints; ++iy)
                 {
                     Yinterp += field(xStartIndex + ix, yStartIndex + iy) * yWeights[iy];
                 }
@@ -209,40 +250,41 @@ namespace core
 
 
 
-    /** \brief Specialization of Interpol for 3D interpolation
+    /** \brief Specialization of MeshToParticle for 3D interpolation
      */
-    template<>
-    class MeshToParticle<3>
+    template<std::size_t interpOrder>
+    class MeshToParticle<3, interpOrder>
     {
     public:
         /** Performs the 3D interpolation
          * \param[in] field is the field from which values are interpolated
-         * \param[in] fieldCentering is the centering (dual or primal) of the field in each
+         * \param[in] Centering is the StaticCentering (dual or primal) of the field in each
          * direction \param[in] startIndex is the first of the nbrPointsSupport indices where to
          * interpolate the field in the 3 directions \param[in] weights are the nbrPointsSupport
          * weights used for the interpolation in the 3 directions
          */
-        template<typename Field, typename Array1, typename Array2>
-        inline double operator()(Field const& field,
-                                 std::array<QtyCentering, 3> const& fieldCentering,
-                                 Array1 const& startIndex, Array2 const& weights)
+        template<typename Field, typename Centering, typename Array1, typename Array2>
+        inline double operator()(Field const& field, Centering, Array1 const& startIndex,
+                                 Array2 const& weights)
         {
-            auto const& xStartIndex = startIndex[static_cast<std::size_t>(fieldCentering[0])][0];
-            auto const& yStartIndex = startIndex[static_cast<std::size_t>(fieldCentering[1])][1];
-            auto const& zStartIndex = startIndex[static_cast<std::size_t>(fieldCentering[2])][2];
-            auto const& xWeights    = weights[static_cast<std::size_t>(fieldCentering[0])][0];
-            auto const& yWeights    = weights[static_cast<std::size_t>(fieldCentering[1])][1];
-            auto const& zWeights    = weights[static_cast<std::size_t>(fieldCentering[2])][2];
-
-            auto order_size        = xWeights.size();
+            static_assert(Centering::dimension == 3, "Error - wrong centering dimension");
+            std::size_t constexpr nbrPoints = nbrPointsSupport(interpOrder);
+
+            auto const xStartIndex = startIndex[Centering::index[0]][0];
+            auto const yStartIndex = startIndex[Centering::index[1]][1];
+            auto const zStartIndex = startIndex[Centering::index[2]][2];
+            auto const& xWeights   = weights[Centering::index[0]][0];
+            auto const& yWeights   = weights[Centering::index[1]][1];
+            auto const& zWeights   = weights[Centering::index[2]][2];
+
             double fieldAtParticle = 0.;
-            for (auto ix = 0u; ix < order_size; ++ix)
+            for (auto ix = 0u; ix < nbrPoints; ++ix)
             {
                 double Yinterp = 0.;
-                for (auto iy = 0u; iy < order_size; ++iy)
+                for (auto iy = 0u; iy < nbrPoints; ++iy)
                 {
                     double Zinterp = 0.;
-                    for (auto iz = 0u; iz < order_size; ++iz)
+                    for (auto iz = 0u; iz < nbrPoints; ++iz)
                     {
                         Zinterp += field(xStartIndex + ix, yStartIndex + iy, zStartIndex + iz)
                                    * zWeights[iz];
@@ -258,8 +300,10 @@ namespace core
 
 
 
-    //! ParticleToMesh projects a particle density and flux to given grids
-    template<std::size_t dim>
+    //! ParticleToMesh projects a particle density and flux to given grids. Like
+    //! MeshToParticle, it is templated by the dimensionality and the interpolation order,
+    //! and its stencils by the centering of the density and of each flux component.
+    template<std::size_t dim, std::size_t interpOrder>
     class ParticleToMesh
     {
     };
@@ -268,46 +312,46 @@ namespace core
 
     /** \brief specialization of ParticleToMesh for 1D interpolation
      */
-    template<>
-    class ParticleToMesh<1>
+    template<std::size_t interpOrder>
+    class ParticleToMesh<1, interpOrder>
     {
     public: /** Performs the 1D interpolation
              * \param[in] density is the field that will be interpolated from the particle Particle
              * \param[in] xFlux is the field that will be interpolated from the particle Particle
              * \param[in] yFlux is the field that will be interpolated from the particle Particle
              * \param[in] zFlux is the field that will be interpolated from the particle Particle
-             * \param[in] fieldCentering is the centering (dual or primal) of the field in each
-             * direction \param[in] particle is the single particle used for the interpolation of
-             * density and flux \param[in] startIndex is the first index for which a particle will
-             * contribute \param[in] weights is the arrays of weights for the associated index
+             * \param[in] DenC, XFluxC, YFluxC, ZFluxC are the StaticCentering (dual or primal) of
+             * the density and flux components \param[in] particle is the single particle used for
+             * the interpolation of density and flux \param[in] startIndex is the first index for
+             * which a particle will contribute \param[in] weights is the arrays of weights for the
+             * associated index
              */
-        template<typename Field, typename Array1, typename Array2, typename Particle,
-                 typename VectorCenteringArray>
-        inline void operator()(Field& density, Field& xFlux, Field& yFlux, Field& zFlux,
-                               std::array<QtyCentering, 1> const& densityCentering,
-                               VectorCenteringArray const& fluxCentering, Particle const& particle,
+        template<typename Field, typename DenC, typename XFluxC, typename YFluxC, typename ZFluxC,
+                 typename Particle, typename Array1, typename Array2>
+        inline void operator()(Field& density, Field& xFlux, Field& yFlux, Field& zFlux, DenC,
+                               XFluxC, YFluxC, ZFluxC, Particle const& particle,
                                Array1 const& startIndex, Array2 const& weights, double coef = 1.)
         {
-            auto const& xDenStartIndex = startIndex[static_cast<int>(densityCentering[0])][0];
-            auto const& xDenWeights    = weights[static_cast<int>(densityCentering[0])][0];
+            std::size_t constexpr nbrPoints = nbrPointsSupport(interpOrder);
 
-            auto const& xXFluxStartIndex = startIndex[static_cast<int>(fluxCentering[0][0])][0];
-            auto const& xXFluxWeights    = weights[static_cast<int>(fluxCentering[0][0])][0];
+            auto const xDenStartIndex = startIndex[DenC::index[0]][0];
+            auto const& xDenWeights   = weights[DenC::index[0]][0];
 
-            auto const& xYFluxStartIndex = startIndex[static_cast<int>(fluxCentering[1][0])][0];
-            auto const& xYFluxWeights    = weights[static_cast<int>(fluxCentering[1][0])][0];
+            auto const xXFluxStartIndex = startIndex[XFluxC::index[0]][0];
+            auto const& xXFluxWeights   = weights[XFluxC::index[0]][0];
 
-            auto const& xZFluxStartIndex = startIndex[static_cast<int>(fluxCentering[2][0])][0];
-            auto const& xZFluxWeights    = weights[static_cast<int>(fluxCentering[2][0])][0];
+            auto const xYFluxStartIndex = startIndex[YFluxC::index[0]][0];
+            auto const& xYFluxWeights   = weights[YFluxC::index[0]][0];
 
-            auto order_size = xDenWeights.size();
+            auto const xZFluxStartIndex = startIndex[ZFluxC::index[0]][0];
+            auto const& xZFluxWeights   = weights[ZFluxC::index[0]][0];
 
             auto const partRho   = particle.weight;
             auto const xPartFlux = particle.v[0] * particle.weight;
             auto const yPartFlux = particle.v[1] * particle.weight;
             auto const zPartFlux = particle.v[2] * particle.weight;
 
-            for (auto ik = 0u; ik < order_size; ++ik)
+            for (auto ik = 0u; ik < nbrPoints; ++ik)
             {
                 density(xDenStartIndex + ik) += partRho * xDenWeights[ik] * coef;
 
@@ -323,52 +367,54 @@ namespace core
 
     /** \brief specialization of ParticleToMesh for 2D interpolation
      */
-    template<>
-    class ParticleToMesh<2>
+    template<std::size_t interpOrder>
+    class ParticleToMesh<2, interpOrder>
     {
     public: /** Performs the 2D interpolation
              * \param[in] density is the field that will be interpolated from the particle Particle
              * \param[in] xFlux is the field that will be interpolated from the particle Particle
              * \param[in] yFlux is the field that will be interpolated from the particle Particle
              * \param[in] zFlux is the field that will be interpolated from the particle Particle
-             * \param[in] fieldCentering is the centering (dual or primal) of the field in each
-             * direction \param[in] particle is the single particle used for the interpolation of
-             * density and flux \param[in] startIndex is the first index for which a particle will
-             * contribute \param[in] weights is the arrays of weights for the associated index
+             * \param[in] DenC, XFluxC, YFluxC, ZFluxC are the StaticCentering (dual or primal) of
+             * the density and flux components in each direction \param[in] particle is the single
+             * particle used for the interpolation of density and flux \param[in] startIndex is the
+             * first index for which a particle will contribute \param[in] weights is the arrays of
+             * weights for the associated index
              */
-        template<typename Field, typename Array1, typename Array2, typename Particle,
-                 typename VectorCenteringArray>
-        inline void operator()(Field& density, Field& xFlux, Field& yFlux, Field& zFlux,
-                               std::array<QtyCentering, 2> const& densityCentering,
-                               VectorCenteringArray const& fluxCentering, Particle const& particle,
+        template<typename Field, typename DenC, typename XFluxC, typename YFluxC, typename ZFluxC,
+                 typename Particle, typename Array1, typename Array2>
+        inline void operator()(Field& density, Field& xFlux, Field& yFlux, Field& zFlux, DenC,
+                               XFluxC, YFluxC, ZFluxC, Particle const& particle,
                                Array1 const& startIndex, Array2 const& weights, double coef = 1.)
         {
-            auto const& xDenStartIndex = startIndex[static_cast<int>(densityCentering[0])][0];
-            auto const& xDenWeights    = weights[static_cast<int>(densityCentering[0])][0];
+            std::size_t constexpr nbrPoints = nbrPointsSupport(interpOrder);
 
-            auto const& xXFluxStartIndex = startIndex[static_cast<int>(fluxCentering[0][0])][0];
-            auto const& xXFluxWeights    = weights[static_cast<int>(fluxCentering[0][0])][0];
+            auto const xDenStartIndex = startIndex[DenC::index[0]][0];
+            auto const& xDenWeights   = weights[DenC::index[0]][0];
 
-            auto const& xYFluxStartIndex = startIndex[static_cast<int>(fluxCentering[1][0])][0];
-            auto const& xYFluxWeights    = weights[static_cast<int>(fluxCentering[1][0])][0];
+            auto const xXFluxStartIndex = startIndex[XFluxC::index[0]][0];
+            auto const& xXFluxWeights   = weights[XFluxC::index[0]][0];
 
-            auto const& xZFluxStartIndex = startIndex[static_cast<int>(fluxCentering[2][0])][0];
-            auto const& xZFluxWeights    = weights[static_cast<int>(fluxCentering[2][0])][0];
+            auto const xYFluxStartIndex = startIndex[YFluxC::index[0]][0];
+            auto const& xYFluxWeights   = weights[YFluxC::index[0]][0];
 
+            auto const xZFluxStartIndex = startIndex[ZFluxC::index[0]][0];
+            auto const& xZFluxWeights   = weights[ZFluxC::index[0]][0];
 
 
 
-            auto const& yDenStartIndex = startIndex[static_cast<int>(densityCentering[0])][0];
-            auto const& yDenWeights    = weights[static_cast<int>(densityCentering[0])][0];
 
-            auto const& yXFluxStartIndex = startIndex[static_cast<int>(fluxCentering[0][1])][0];
-            auto const& yXFluxWeights    = weights[static_cast<int>(fluxCentering[0][1])][0];
+            auto const yDenStartIndex = startIndex[DenC::index[1]][1];
+            auto const& yDenWeights   = weights[DenC::index[1]][1];
 
-            auto const& yYFluxStartIndex = startIndex[static_cast<int>(fluxCentering[1][1])][0];
-            auto const& yYFluxWeights    = weights[static_cast<int>(fluxCentering[1][1])][0];
+            auto const yXFluxStartIndex = startIndex[XFluxC::index[1]][1];
+            auto const& yXFluxWeights   = weights[XFluxC::index[1]][1];
 
-            auto const& yZFluxStartIndex = startIndex[static_cast<int>(fluxCentering[2][1])][0];
-            auto const& yZFluxWeights    = weights[static_cast<int>(fluxCentering[2][1])][0];
+            auto const yYFluxStartIndex = startIndex[YFluxC::index[1]][1];
+            auto const& yYFluxWeights   = weights[YFluxC::index[1]][1];
+
+            auto const yZFluxStartIndex = startIndex[ZFluxC::index[1]][1];
+            auto const& yZFluxWeights   = weights[ZFluxC::index[1]][1];
 
 
 
@@ -377,10 +423,9 @@ namespace core
             auto const yPartFlux = particle.v[1] * particle.weight * coef;
             auto const zPartFlux = particle.v[2] * particle.weight * coef;
 
-            auto order_size = xDenWeights.size();
-            for (auto ix = 0u; ix < order_size; ++ix)
+            for (auto ix = 0u; ix < nbrPoints; ++ix)
             {
-                for (auto iy = 0u; iy < order_size; ++iy)
+                for (auto iy = 0u; iy < nbrPoints; ++iy)
                 {
                     density(xDenStartIndex + ix, yDenStartIndex + iy)
                         += partRho * xDenWeights[ix] * yDenWeights[iy];
@@ -403,92 +448,95 @@ namespace core
 
     /** \brief specialization of ParticleToMesh for 3D interpolation
      */
-    template<>
-    class ParticleToMesh<3>
+    template<std::size_t interpOrder>
+    class ParticleToMesh<3, interpOrder>
     {
     public: /** Performs the 3D interpolation
              * \param[in] density is the field that will be interpolated from the particle Particle
              * \param[in] xFlux is the field that will be interpolated from the particle Particle
              * \param[in] yFlux is the field that will be interpolated from the particle Particle
              * \param[in] zFlux is the field that will be interpolated from the particle Particle
-             * \param[in] fieldCentering is the centering (dual or primal) of the field in each
-             * direction \param[in] particle is the single particle used for the interpolation of
-             * density and flux \param[in] startIndex is the first index for which a particle will
-             * contribute \param[in] weights is the arrays of weights for the associated index
+             * \param[in] DenC, XFluxC, YFluxC, ZFluxC are the StaticCentering (dual or primal) of
+             * the density and flux components in each direction \param[in] particle is the single
+             * particle used for the interpolation of density and flux \param[in] startIndex is the
+             * first index for which a particle will contribute \param[in] weights is the arrays of
+             * weights for the associated index
              */
-        template<typename Field, typename Array1, typename Array2, typename Particle,
-                 typename VectorCenteringArray>
-        inline void operator()(Field& density, Field& xFlux, Field& yFlux, Field& zFlux,
-                               std::array<QtyCentering, 3> const& densityCentering,
-                               VectorCenteringArray const& fluxCentering, Particle const& particle,
+        template<typename Field, typename DenC, typename XFluxC, typename YFluxC, typename ZFluxC,
+                 typename Particle, typename Array1, typename Array2>
+        inline void operator()(Field& density, Field& xFlux, Field& yFlux, Field& zFlux, DenC,
+                               XFluxC, YFluxC, ZFluxC, Particle const& particle,
                                Array1 const& startIndex, Array2 const& weights, double coef = 1.)
         {
-            auto const& xDenStartIndex = startIndex[static_cast<int>(densityCentering[0])][0];
-            auto const& xDenWeights    = weights[static_cast<int>(densityCentering[0])][0];
+            std::size_t constexpr nbrPoints = nbrPointsSupport(interpOrder);
 
-            auto const& xXFluxStartIndex = startIndex[static_cast<int>(fluxCentering[0][0])][0];
-            auto const& xXFluxWeights    = weights[static_cast<int>(fluxCentering[0][0])][0];
+            auto const xDenStartIndex = startIndex[DenC::index[0]][0];
+            auto const& xDenWeights   = weights[DenC::index[0]][0];
 
-            auto const& xYFluxStartIndex = startIndex[static_cast<int>(fluxCentering[1][0])][0];
-            auto const& xYFluxWeights    = weights[static_cast<int>(fluxCentering[1][0])][0];
+            auto const xXFluxStartIndex = startIndex[XFluxC::index[0]][0];
+            auto const& xXFluxWeights   = weights[XFluxC::index[0]][0];
 
-            auto const& xZFluxStartIndex = startIndex[static_cast<int>(fluxCentering[2][0])][0];
-            auto const& xZFluxWeights    = weights[static_cast<int>(fluxCentering[2][0])][0];
+            auto const xYFluxStartIndex = startIndex[YFluxC::index[0]][0];
+            auto const& xYFluxWeights   = weights[YFluxC::index[0]][0];
 
+            auto const xZFluxStartIndex = startIndex[ZFluxC::index[0]][0];
+            auto const& xZFluxWeights   = weights[ZFluxC::index[0]][0];
 
 
 
-            auto const& yDenStartIndex = startIndex[static_cast<int>(densityCentering[0])][0];
-            auto const& yDenWeights    = weights[static_cast<int>(densityCentering[0])][0];
 
-            auto const& yXFluxStartIndex = startIndex[static_cast<int>(fluxCentering[0][1])][0];
-            auto const& yXFluxWeights    = weights[static_cast<int>(fluxCentering[0][1])][0];
+            auto const yDenStartIndex = startIndex[DenC::index[1]][1];
+            auto const& yDenWeights   = weights[DenC::index[1]][1];
 
-            auto const& yYFluxStartIndex = startIndex[static_cast<int>(fluxCentering[1][1])][0];
-            auto const& yYFluxWeights    = weights[static_cast<int>(fluxCentering[1][1])][0];
+            auto const yXFluxStartIndex = startIndex[XFluxC::index[1]][1];
+            auto const& yXFluxWeights   = weights[XFluxC::index[1]][1];
 
-            auto const& yZFluxStartIndex = startIndex[static_cast<int>(fluxCentering[2][1])][0];
-            auto const& yZFluxWeights    = weights[static_cast<int>(fluxCentering[2][1])][0];
+            auto const yYFluxStartIndex = startIndex[YFluxC::index[1]][1];
+            auto const& yYFluxWeights   = weights[YFluxC::index[1]][1];
 
+            auto const yZFluxStartIndex = startIndex[ZFluxC::index[1]][1];
+            auto const& yZFluxWeights   = weights[ZFluxC::index[1]][1];
 
 
 
-            auto const& zDenStartIndex = startIndex[static_cast<int>(densityCentering[0])][0];
-            auto const& zDenWeights    = weights[static_cast<int>(densityCentering[0])][0];
 
-            auto const& zXFluxStartIndex = startIndex[static_cast<int>(fluxCentering[0][2])][0];
-            auto const& zXFluxWeights    = weights[static_cast<int>(fluxCentering[0][2])][0];
+            auto const zDenStartIndex = startIndex[DenC::index[2]][2];
+            auto const& zDenWeights   = weights[DenC::index[2]][2];
 
-            auto const& zYFluxStartIndex = startIndex[static_cast<int>(fluxCentering[1][2])][0];
-            auto const& zYFluxWeights    = weights[static_cast<int>(fluxCentering[1][2])][0];
+            auto const zXFluxStartIndex = startIndex[XFluxC::index[2]][2];
+            auto const& zXFluxWeights   = weights[XFluxC::index[2]][2];
 
-            auto const& zZFluxStartIndex = startIndex[static_cast<int>(fluxCentering[2][2])][0];
-            auto const& zZFluxWeights    = weights[static_cast<int>(fluxCentering[2][2])][0];
+            auto const zYFluxStartIndex = startIndex[YFluxC::index[2]][2];
+            auto const& zYFluxWeights   = weights[YFluxC::index[2]][2];
+
+            auto const zZFluxStartIndex = startIndex[ZFluxC::index[2]][2];
+            auto const& zZFluxWeights   = weights[ZFluxC::index[2]][2];
 
             auto const partRho   = particle.weight * coef;
             auto const xPartFlux = particle.v[0] * particle.weight * coef;
             auto const yPartFlux = particle.v[1] * particle.weight * coef;
-            auto const zPartFlux = particle.v[2] * particle.weigth * coef;
+            auto const zPartFlux = particle.v[2] * particle.weight * coef;
 
-            auto order_size = xDenWeights.size();
-            for (auto ix = 0u; ix < order_size; ++ix)
+            for (auto ix = 0u; ix < nbrPoints; ++ix)
             {
-                for (auto iy = 0u; iy < order_size; ++iy)
+                for (auto iy = 0u; iy < nbrPoints; ++iy)
                 {
-                    for (auto iz = 0u; iz < order_size; ++iz)
+                    for (auto iz = 0u; iz < nbrPoints; ++iz)
                     {
                         density(xDenStartIndex + ix, yDenStartIndex + iy, zDenStartIndex + iz)
                             += partRho * xDenWeights[ix] * yDenWeights[iy] * zDenWeights[iz];
 
                         xFlux(xXFluxStartIndex + ix, yXFluxStartIndex + iy, zXFluxStartIndex + iz)
-                            += xPartFlux * xXFluxWeights[ix] * yXFluxWeights[iy] * zXFluxWeights;
+                            += xPartFlux * xXFluxWeights[ix] * yXFluxWeights[iy]
+                               * zXFluxWeights[iz];
 
                         yFlux(xYFluxStartIndex + ix, yYFluxStartIndex + iy, zYFluxStartIndex + iz)
                             += yPartFlux * xYFluxWeights[ix] * yYFluxWeights[iy]
                                * zYFluxWeights[iz];
 
                         zFlux(xZFluxStartIndex + ix, yZFluxStartIndex + iy, zZFluxStartIndex + iz)
-                            += zPartFlux * xZFluxWeights[ix] * yZFluxWeights[iy] * zZFluxWeights;
+                            += zPartFlux * xZFluxWeights[ix] * yZFluxWeights[iy]
+                               * zZFluxWeights[iz];
                     }
                 }
             }
@@ -498,8 +546,73 @@ namespace core
 
 
 
+    /** \brief ShapeFactorCache stores, for each particle of a range, the start indexes and
+     * weights of the primal and dual interpolation stencils in each direction.
+     *
+     * Entry i corresponds to the i-th particle of the range given to
+     * Interpolator::computeShapeFactors(). The entries are valid as long as the particles
+     * are not moved, so that the field gather and the moment deposit done at the same
+     * particle positions only compute them once.
+     */
+    template<std::size_t dim, std::size_t interpOrder>
+    class ShapeFactorCache
+    {
+    public:
+        // array[dual/primal][dim]
+        using StartIndexes = std::array<std::array<int, dim>, 2>;
+        using Weights
+            = std::array<std::array<std::array<double, nbrPointsSupport(interpOrder)>, dim>, 2>;
+
+        void resize(std::size_t size)
+        {
+            startIndexes_.resize(size);
+            weights_.resize(size);
+        }
+
+        std::size_t size() const { return startIndexes_.size(); }
+
+        StartIndexes& startIndexes(std::size_t iPart) { return startIndexes_[iPart]; }
+        StartIndexes const& startIndexes(std::size_t iPart) const { return startIndexes_[iPart]; }
+
+        Weights& weights(std::size_t iPart) { return weights_[iPart]; }
+        Weights const& weights(std::size_t iPart) const { return weights_[iPart]; }
+
+    private:
+        std::vector<StartIndexes> startIndexes_;
+        std::vector<Weights> weights_;
+    };
+
+
+
+
+    /** \brief ParallelDeposit selects the parallel moment deposit of the Interpolator.
+     *
+     * The cells of the particles are split in tiles of cellsPerTile cells in each direction
+     * (at least the stencil width), and particles are grouped by tile with a counting sort of
+     * their indexes, like the CellSorter does. Tiles are colored by the parity of their
+     * coordinates: two tiles of the same color are at least one tile apart, so their stencils
+     * never touch the same node. The 2^dim colors are deposited one after the other, the tiles
+     * of a color in parallel, each tile directly in the fields. No accumulator is needed, and
+     * each node gets the contributions of its tiles in the color order and those of a tile in
+     * the particle order: the result does not depend on the number of threads.
+     */
+    struct ParallelDeposit
+    {
+        int cellsPerTile = 8;
+    };
+
+
+
+
     /** \brief Interpolator is used to perform particle-mesh interpolations using
      * 1st, 2nd or 3rd order interpolation in 1D, 2D or 3D, on a given layout.
+     *
+     * Start indexes and weights are either computed on the fly for each particle, or read
+     * from a ShapeFactorCache previously filled by computeShapeFactors().
+     *
+     * The stencils are specialized on the dimension, the order and the centering of each
+     * quantity on the layout (see StaticCentering), so that their loops have compile-time
+     * trip counts and are fully unrolled.
      */
     template<std::size_t dim, std::size_t interpOrder>
     class Interpolator : private Weighter<interpOrder>
@@ -507,6 +620,10 @@ namespace core
     public:
         auto static constexpr interp_order = interpOrder;
         auto static constexpr dimension    = dim;
+
+        using ShapeFactors = ShapeFactorCache<dim, interpOrder>;
+
+
         /**\brief interpolate electromagnetic fields on all particles in the range
          *
          * For each particle :
@@ -519,150 +636,224 @@ namespace core
         inline void operator()(PartIterator begin, PartIterator end, Electromag const& Em,
                                GridLayout const& layout)
         {
-            // this lambda calculates the startIndex and the nbrPointsSupport() weights for
-            // dual field interpolation and puts this at the corresponding location
-            // in 'startIndex' and 'weights'. For dual fields, the normalizedPosition
-            // is offseted compared to primal ones.
-            auto indexAndWeightDual = [this, &layout](auto const& part) {
-                for (auto iDim = 0u; iDim < dimension; ++iDim)
-                {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim] + dualOffset(interpOrder);
+            meshToParticles_<GridLayout>(begin, end, Em, [this, &layout](auto const& part, std::size_t) {
+                indexAndWeights_(part, layout, startIndex_, weights_);
+                return std::tie(startIndex_, weights_);
+            });
+        }
 
-                    startIndex_[centering2int(QtyCentering::dual)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
 
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::dual)][iDim],
-                        weights_[centering2int(QtyCentering::dual)][iDim]);
-                }
-            };
 
-            // does the same as above but for a primal field
-            auto indexAndWeightPrimal = [this, &layout](auto const& part) {
-                for (auto iDim = 0u; iDim < dimension; ++iDim)
-                {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim];
+        /**\brief same as above but start indexes and weights are read from the cache
+         * instead of being computed. The cache must have been filled with computeShapeFactors()
+         * for the same particle range.
+         */
+        template<typename PartIterator, typename Electromag, typename GridLayout>
+        inline void operator()(PartIterator begin, PartIterator end, Electromag const& Em,
+                               GridLayout const&, ShapeFactors const& cache)
+        {
+            meshToParticles_<GridLayout>(begin, end, Em, [&cache](auto const&, std::size_t iPart) {
+                return std::tie(cache.startIndexes(iPart), cache.weights(iPart));
+            });
+        }
 
-                    startIndex_[centering2int(QtyCentering::primal)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
 
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::primal)][iDim],
-                        weights_[centering2int(QtyCentering::primal)][iDim]);
-                }
-            };
 
-            auto const& Ex = Em.E.getComponent(Component::X);
-            auto const& Ey = Em.E.getComponent(Component::Y);
-            auto const& Ez = Em.E.getComponent(Component::Z);
-            auto const& Bx = Em.B.getComponent(Component::X);
-            auto const& By = Em.B.getComponent(Component::Y);
-            auto const& Bz = Em.B.getComponent(Component::Z);
 
-            auto const ExCentering = GridLayout::centering(HybridQuantity::Scalar::Ex);
-            auto const EyCentering = GridLayout::centering(HybridQuantity::Scalar::Ey);
-            auto const EzCentering = GridLayout::centering(HybridQuantity::Scalar::Ez);
-            auto const BxCentering = GridLayout::centering(HybridQuantity::Scalar::Bx);
-            auto const ByCentering = GridLayout::centering(HybridQuantity::Scalar::By);
-            auto const BzCentering = GridLayout::centering(HybridQuantity::Scalar::Bz);
+        /**\brief deposit the density and flux of all particles in the range
+         *
+         * For each particle :
+         *  - The function first calculates the startIndex and weights for interpolation at
+         * order InterpOrder and in dimension dim for dual and primal nodes
+         *  - then it uses ParticleToMesh to deposit the particle density and flux
+         * onto the grid.
+         */
+        template<typename PartIterator, typename VecField, typename GridLayout>
+        inline void operator()(PartIterator begin, PartIterator end,
+                               typename VecField::field_type& density, VecField& flux,
+                               GridLayout const& layout, double coef = 1.)
+        {
+            particlesToMesh_<GridLayout>(begin, end, density, flux, coef,
+                             [this, &layout](auto const& part, std::size_t) {
+                                 indexAndWeights_(part, layout, startIndex_, weights_);
+                                 return std::tie(startIndex_, weights_);
+                             });
+        }
 
 
-            // for each particle, first calculate the startIndex and weights
-            // for dual and primal quantities.
-            // then, knowing the centering (primal or dual) of each electromagnetic
-            // component, we use Interpol to actually perform the interpolation.
-            // the trick here is that the StartIndex and weights have only been calculated
-            // twice, and not for each E,B component.
-            for (auto currPart = begin; currPart != end; ++currPart)
-            {
-                indexAndWeightPrimal(*currPart);
-                indexAndWeightDual(*currPart);
-
-                currPart->Ex = meshToParticle_(Ex, ExCentering, startIndex_, weights_);
-                currPart->Ey = meshToParticle_(Ey, EyCentering, startIndex_, weights_);
-                currPart->Ez = meshToParticle_(Ez, EzCentering, startIndex_, weights_);
-                currPart->Bx = meshToParticle_(Bx, BxCentering, startIndex_, weights_);
-                currPart->By = meshToParticle_(By, ByCentering, startIndex_, weights_);
-                currPart->Bz = meshToParticle_(Bz, BzCentering, startIndex_, weights_);
-            }
+
+        /**\brief same as above but start indexes and weights are read from the cache
+         * instead of being computed. The cache must have been filled with computeShapeFactors()
+         * for the same particle range.
+         */
+        template<typename PartIterator, typename VecField, typename GridLayout>
+        inline void operator()(PartIterator begin, PartIterator end,
+                               typename VecField::field_type& density, VecField& flux,
+                               GridLayout const&, ShapeFactors const& cache, double coef = 1.)
+        {
+            particlesToMesh_<GridLayout>(begin, end, density, flux, coef,
+                             [&cache](auto const&, std::size_t iPart) {
+                                 return std::tie(cache.startIndexes(iPart), cache.weights(iPart));
+                             });
         }
 
 
 
 
-        /**\brief interpolate electromagnetic fields on all particles in the range
-         *
-         * For each particle :
-         *  - The function first calculates the startIndex and weights for interpolation at
-         * order InterpOrder and in dimension dim for dual and primal nodes
-         *  - then it uses Interpol<> to calculate the interpolation of E and B components
-         * onto the particle.
+        /**\brief same as above but the particles are deposited in parallel with OpenMP
+         * if PHARE is built with it, see ParallelDeposit.
          */
-        template<typename PartIterator, typename VecField, typename GridLayout,
-                 typename Field = typename VecField::field_type>
-        inline void operator()(PartIterator begin, PartIterator end, Field& density, VecField& flux,
-                               GridLayout const& layout, double coef = 1.)
+        template<typename PartIterator, typename VecField, typename GridLayout>
+        inline void operator()(PartIterator begin, PartIterator end,
+                               typename VecField::field_type& density, VecField& flux,
+                               GridLayout const& layout, ParallelDeposit const& parallel,
+                               double coef = 1.)
         {
-            // this lambda calculates the startIndex and the order+1 weights for
-            // dual field interpolation and puts this at the corresponding location
-            // in 'startIndex' and 'weights'. For dual fields, the normalizedPosition
-            // is offseted compared to primal ones.
-            auto indexAndWeightDual = [this, &layout](auto const& part) {
+            using DenC   = static_centering_t<GridLayout, HybridQuantity::Scalar::rho>;
+            using XFluxC = static_centering_t<GridLayout, HybridQuantity::Scalar::Vx>;
+            using YFluxC = static_centering_t<GridLayout, HybridQuantity::Scalar::Vy>;
+            using ZFluxC = static_centering_t<GridLayout, HybridQuantity::Scalar::Vz>;
+
+            auto constexpr nbrPoints = nbrPointsSupport(interpOrder);
+
+            auto& xFlux = flux.getComponent(Component::X);
+            auto& yFlux = flux.getComponent(Component::Y);
+            auto& zFlux = flux.getComponent(Component::Z);
+
+            auto const nbrParticles = static_cast<std::size_t>(std::distance(begin, end));
+            if (nbrParticles == 0)
+                return;
+
+            // tiles two apart must not share nodes: a stencil starts at most one node before
+            // the cell of its particle and spans nbrPoints nodes
+            auto const cellsPerTile = std::max(parallel.cellsPerTile, nbrPoints);
+
+            auto localCell = [&layout](auto const& particle) {
+                return layout.AMRToLocal(Point{particle.iCell});
+            };
+
+            std::array<int, dimension> lowerCell;
+            std::array<int, dimension> upperCell;
+            lowerCell.fill(std::numeric_limits<int>::max());
+            upperCell.fill(std::numeric_limits<int>::min());
+            for (auto currPart = begin; currPart != end; ++currPart)
+            {
+                auto iCell = localCell(*currPart);
                 for (auto iDim = 0u; iDim < dimension; ++iDim)
                 {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim] + dualOffset(interpOrder);
+                    lowerCell[iDim] = std::min(lowerCell[iDim], static_cast<int>(iCell[iDim]));
+                    upperCell[iDim] = std::max(upperCell[iDim], static_cast<int>(iCell[iDim]));
+                }
+            }
 
-                    startIndex_[centering2int(QtyCentering::dual)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
+            std::array<std::size_t, dimension> nbrTilesPerDim;
+            std::size_t nbrTiles = 1;
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                nbrTilesPerDim[iDim]
+                    = static_cast<std::size_t>((upperCell[iDim] - lowerCell[iDim]) / cellsPerTile)
+                      + 1;
+                nbrTiles *= nbrTilesPerDim[iDim];
+            }
 
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::dual)][iDim],
-                        weights_[centering2int(QtyCentering::dual)][iDim]);
+            auto tileCoordinates = [&](auto const& particle) {
+                auto iCell = localCell(particle);
+                std::array<std::size_t, dimension> tile;
+                for (auto iDim = 0u; iDim < dimension; ++iDim)
+                {
+                    tile[iDim] = static_cast<std::size_t>(
+                        (static_cast<int>(iCell[iDim]) - lowerCell[iDim]) / cellsPerTile);
                 }
+                return tile;
             };
 
-            // does the same as above but for a primal field
-            auto indexAndWeightPrimal = [this, &layout](auto const& part) {
+            auto tileIndex = [&nbrTilesPerDim](std::array<std::size_t, dimension> const& tile) {
+                std::size_t index = 0;
                 for (auto iDim = 0u; iDim < dimension; ++iDim)
                 {
-                    auto iCell           = layout.AMRToLocal(Point{part.iCell});
-                    double normalizedPos = iCell[iDim] + part.delta[iDim];
+                    index = index * nbrTilesPerDim[iDim] + tile[iDim];
+                }
+                return index;
+            };
 
-                    startIndex_[centering2int(QtyCentering::primal)][iDim]
-                        = computeStartIndex<interpOrder>(normalizedPos);
+            // counting sort of the particle indexes by tile, particles of a tile keep their order
+            std::vector<std::size_t> particleTiles(nbrParticles);
+            std::vector<std::size_t> tileOffsets(nbrTiles + 1, 0);
+            std::size_t iPart = 0;
+            for (auto currPart = begin; currPart != end; ++currPart, ++iPart)
+            {
+                particleTiles[iPart] = tileIndex(tileCoordinates(*currPart));
+                ++tileOffsets[particleTiles[iPart] + 1];
+            }
+            std::partial_sum(std::begin(tileOffsets), std::end(tileOffsets),
+                             std::begin(tileOffsets));
 
-                    weightComputer_.computeWeight(
-                        normalizedPos, startIndex_[centering2int(QtyCentering::primal)][iDim],
-                        weights_[centering2int(QtyCentering::primal)][iDim]);
+            std::vector<std::size_t> tileParticles(nbrParticles);
+            {
+                auto nextSlot = tileOffsets;
+                for (iPart = 0; iPart < nbrParticles; ++iPart)
+                {
+                    tileParticles[nextSlot[particleTiles[iPart]]++] = iPart;
                 }
+            }
+
+            auto tileColor = [&nbrTilesPerDim](std::size_t index) {
+                std::size_t color = 0;
+                for (auto iDim = dimension; iDim-- > 0;)
+                {
+                    color |= ((index % nbrTilesPerDim[iDim]) % 2) << iDim;
+                    index /= nbrTilesPerDim[iDim];
+                }
+                return color;
             };
 
-            auto& xFlux = flux.getComponent(Component::X);
-            auto& yFlux = flux.getComponent(Component::Y);
-            auto& zFlux = flux.getComponent(Component::Z);
+            auto const nbrColors = std::size_t{1} << dimension;
+            for (auto color = std::size_t{0}; color < nbrColors; ++color)
+            {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+                for (long iTile = 0; iTile < static_cast<long>(nbrTiles); ++iTile)
+                {
+                    auto const tile = static_cast<std::size_t>(iTile);
+                    if (tileColor(tile) != color)
+                        continue;
+
+                    // the startIndex_ and weights_ members cannot be shared between threads
+                    StartIndexes startIndex;
+                    Weights weights;
+                    ParticleToMesh<dimension, interpOrder> particleToMesh;
 
-            auto constexpr densityCentering = GridLayout::centering(HybridQuantity::Scalar::rho);
-            auto constexpr fluxCentering    = GridLayout::centering(HybridQuantity::Vector::V);
+                    for (auto slot = tileOffsets[tile]; slot < tileOffsets[tile + 1]; ++slot)
+                    {
+                        auto const& particle
+                            = *std::next(begin, static_cast<long>(tileParticles[slot]));
+                        indexAndWeights_(particle, layout, startIndex, weights);
+                        particleToMesh(density, xFlux, yFlux, zFlux, DenC{}, XFluxC{}, YFluxC{},
+                                       ZFluxC{}, particle, startIndex, weights, coef);
+                    }
+                }
+            }
+        }
 
 
-            // for each particle, first calculate the startIndex and weights
-            // for dual and primal quantities.
-            // then, knowing the centering (primal or dual) of each electromagnetic
-            // component, we use Interpol to actually perform the interpolation.
-            // the trick here is that the StartIndex and weights have only been calculated
-            // twice, and not for each E,B component.
-            for (auto currPart = begin; currPart != end; ++currPart)
-            {
-                // TODO #3375
-                indexAndWeightPrimal(*currPart);
-                indexAndWeightDual(*currPart);
 
 
-                particleToMesh_(density, xFlux, yFlux, zFlux, densityCentering, fluxCentering,
-                                *currPart, startIndex_, weights_, coef);
+        /**\brief computes the start indexes and weights of primal and dual stencils for all
+         * particles in the range and stores them in the cache, which is resized to the number
+         * of particles in the range.
+         */
+        template<typename PartIterator, typename GridLayout>
+        void computeShapeFactors(PartIterator begin, PartIterator end, GridLayout const& layout,
+                                 ShapeFactors& cache)
+        {
+            cache.resize(static_cast<std::size_t>(std::distance(begin, end)));
+
+            std::size_t iPart = 0;
+            for (auto currPart = begin; currPart != end; ++currPart, ++iPart)
+            {
+                indexAndWeights_(*currPart, layout, cache.startIndexes(iPart),
+                                 cache.weights(iPart));
             }
         }
 
@@ -673,14 +864,121 @@ namespace core
         static_assert(dimension <= 3 && dimension > 0 && interpOrder >= 1 && interpOrder <= 3,
                       "error");
 
+        using StartIndexes = typename ShapeFactors::StartIndexes;
+        using Weights      = typename ShapeFactors::Weights;
+
+
+        /** calculates the startIndex and the nbrPointsSupport() weights for primal and dual
+         * field interpolation of the particle. For dual fields, the normalizedPosition
+         * is offseted compared to primal ones. The local cell of the particle is computed
+         * only once for both centerings and all directions.
+         */
+        template<typename Particle, typename GridLayout>
+        void indexAndWeights_(Particle const& part, GridLayout const& layout,
+                              StartIndexes& startIndex, Weights& weights)
+        {
+            auto constexpr primal = centering2int(QtyCentering::primal);
+            auto constexpr dual   = centering2int(QtyCentering::dual);
+
+            auto iCell = layout.AMRToLocal(Point{part.iCell});
+
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                double normalizedPos = iCell[iDim] + part.delta[iDim];
+
+                startIndex[primal][iDim] = computeStartIndex<interpOrder>(normalizedPos);
+                weightComputer_.computeWeight(normalizedPos, startIndex[primal][iDim],
+                                              weights[primal][iDim]);
+
+                normalizedPos += dualOffset(interpOrder);
+
+                startIndex[dual][iDim] = computeStartIndex<interpOrder>(normalizedPos);
+                weightComputer_.computeWeight(normalizedPos, startIndex[dual][iDim],
+                                              weights[dual][iDim]);
+            }
+        }
+
+
+
+
+        /** for each particle, first get the startIndex and weights for dual and primal
+         * quantities from shapeFactors(particle, particleIndex).
+         * then, knowing the centering (primal or dual) of each electromagnetic
+         * component, we use Interpol to actually perform the interpolation.
+         * the trick here is that the StartIndex and weights have only been calculated
+         * twice, and not for each E,B component.
+         */
+        template<typename GridLayout, typename PartIterator, typename Electromag,
+                 typename ShapeFactorsOf>
+        void meshToParticles_(PartIterator begin, PartIterator end, Electromag const& Em,
+                              ShapeFactorsOf&& shapeFactors)
+        {
+            auto const& Ex = Em.E.getComponent(Component::X);
+            auto const& Ey = Em.E.getComponent(Component::Y);
+            auto const& Ez = Em.E.getComponent(Component::Z);
+            auto const& Bx = Em.B.getComponent(Component::X);
+            auto const& By = Em.B.getComponent(Component::Y);
+            auto const& Bz = Em.B.getComponent(Component::Z);
+
+            using ExCentering = static_centering_t<GridLayout, HybridQuantity::Scalar::Ex>;
+            using EyCentering = static_centering_t<GridLayout, HybridQuantity::Scalar::Ey>;
+            using EzCentering = static_centering_t<GridLayout, HybridQuantity::Scalar::Ez>;
+            using BxCentering = static_centering_t<GridLayout, HybridQuantity::Scalar::Bx>;
+            using ByCentering = static_centering_t<GridLayout, HybridQuantity::Scalar::By>;
+            using BzCentering = static_centering_t<GridLayout, HybridQuantity::Scalar::Bz>;
+
+            std::size_t iPart = 0;
+            for (auto currPart = begin; currPart != end; ++currPart, ++iPart)
+            {
+                auto const& [startIndex, weights] = shapeFactors(*currPart, iPart);
+
+                currPart->Ex = meshToParticle_(Ex, ExCentering{}, startIndex, weights);
+                currPart->Ey = meshToParticle_(Ey, EyCentering{}, startIndex, weights);
+                currPart->Ez = meshToParticle_(Ez, EzCentering{}, startIndex, weights);
+                currPart->Bx = meshToParticle_(Bx, BxCentering{}, startIndex, weights);
+                currPart->By = meshToParticle_(By, ByCentering{}, startIndex, weights);
+                currPart->Bz = meshToParticle_(Bz, BzCentering{}, startIndex, weights);
+            }
+        }
+
+
+
+
+        //! same as meshToParticles_ but deposits the density and flux of the particles
+        template<typename GridLayout, typename PartIterator, typename Field, typename VecField,
+                 typename ShapeFactorsOf>
+        void particlesToMesh_(PartIterator begin, PartIterator end, Field& density,
+                              VecField& flux, double coef, ShapeFactorsOf&& shapeFactors)
+        {
+            auto& xFlux = flux.getComponent(Component::X);
+            auto& yFlux = flux.getComponent(Component::Y);
+            auto& zFlux = flux.getComponent(Component::Z);
+
+            using DenC   = static_centering_t<GridLayout, HybridQuantity::Scalar::rho>;
+            using XFluxC = static_centering_t<GridLayout, HybridQuantity::Scalar::Vx>;
+            using YFluxC = static_centering_t<GridLayout, HybridQuantity::Scalar::Vy>;
+            using ZFluxC = static_centering_t<GridLayout, HybridQuantity::Scalar::Vz>;
+
+            std::size_t iPart = 0;
+            for (auto currPart = begin; currPart != end; ++currPart, ++iPart)
+            {
+                auto const& [startIndex, weights] = shapeFactors(*currPart, iPart);
+
+                particleToMesh_(density, xFlux, yFlux, zFlux, DenC{}, XFluxC{}, YFluxC{}, ZFluxC{},
+                                *currPart, startIndex, weights, coef);
+            }
+        }
+
+
+
+
         Weighter<interpOrder> weightComputer_;
-        MeshToParticle<dimension> meshToParticle_;
-        ParticleToMesh<dimension> particleToMesh_;
+        MeshToParticle<dimension, interpOrder> meshToParticle_;
+        ParticleToMesh<dimension, interpOrder> particleToMesh_;
 
         // array[dual/primal][dim]
-        std::array<std::array<int, dimension>, 2> startIndex_;
-        std::array<std::array<std::array<double, nbrPointsSupport(interpOrder)>, dimension>, 2>
-            weights_;
+        StartIndexes startIndex_;
+        Weights weights_;
 
         /**
          * @brief dualOffset returns the offset by which changing the
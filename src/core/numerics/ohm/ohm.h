@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <iostream>
+#include <limits>
 
 #include "data/grid/gridlayout.h"
 #include "data/grid/gridlayoutdefs.h"
@@ -18,6 +19,9 @@ namespace core
      * This implementation is used by the Ohm object to calculate the electric field
      * It is templated by the layout and the dimension so specialized template actually do the job
      *
+     * Only the nodes of Enew whose X index is in [xLower, xUpper] are computed, so that the
+     * FusedFieldSolver can sweep a patch by slabs. The operator object passes the whole range.
+     *
      */
     template<typename GridLayout, std::size_t dim>
     class OhmImpl
@@ -74,14 +78,14 @@ namespace core
     public:
         template<typename Field, typename VecField>
         void operator()(Field const& n, VecField const& Ve, Field const& Pe, VecField const& B,
-                        VecField const& J, VecField& Enew)
+                        VecField const& J, VecField& Enew, uint32 xLower, uint32 xUpper)
         {
             auto& Ex = Enew.getComponent(Component::X);
             auto& Ey = Enew.getComponent(Component::Y);
             auto& Ez = Enew.getComponent(Component::Z);
 
-            auto ix0 = this->layout_->physicalStartIndex(Ex, Direction::X);
-            auto ix1 = this->layout_->physicalEndIndex(Ex, Direction::X);
+            auto ix0 = windowStart(this->layout_->physicalStartIndex(Ex, Direction::X), xLower);
+            auto ix1 = windowEnd(this->layout_->physicalEndIndex(Ex, Direction::X), xUpper);
 
             for (auto ix = ix0; ix <= ix1; ++ix)
             {
@@ -91,8 +95,8 @@ namespace core
                          + hyperresistive_(J, {ix}, ComponentTag<Component::X>{});
             }
 
-            ix0 = this->layout_->physicalStartIndex(Ey, Direction::X);
-            ix1 = this->layout_->physicalEndIndex(Ey, Direction::X);
+            ix0 = windowStart(this->layout_->physicalStartIndex(Ey, Direction::X), xLower);
+            ix1 = windowEnd(this->layout_->physicalEndIndex(Ey, Direction::X), xUpper);
 
             for (auto ix = ix0; ix <= ix1; ++ix)
             {
@@ -102,8 +106,8 @@ namespace core
                          + hyperresistive_(J, {ix}, ComponentTag<Component::Y>{});
             }
 
-            ix0 = this->layout_->physicalStartIndex(Ez, Direction::X);
-            ix1 = this->layout_->physicalEndIndex(Ez, Direction::X);
+            ix0 = windowStart(this->layout_->physicalStartIndex(Ez, Direction::X), xLower);
+            ix1 = windowEnd(this->layout_->physicalEndIndex(Ez, Direction::X), xUpper);
 
             for (auto ix = ix0; ix <= ix1; ++ix)
             {
@@ -286,14 +290,14 @@ namespace core
     public:
         template<typename Field, typename VecField>
         void operator()(Field const& n, VecField const& Ve, Field const& Pe, VecField const& B,
-                        VecField const& J, VecField& Enew)
+                        VecField const& J, VecField& Enew, uint32 xLower, uint32 xUpper)
         {
             auto& Ex = Enew.getComponent(Component::X);
             auto& Ey = Enew.getComponent(Component::Y);
             auto& Ez = Enew.getComponent(Component::Z);
 
-            auto ix0 = this->layout_->physicalStartIndex(Ex, Direction::X);
-            auto ix1 = this->layout_->physicalEndIndex(Ex, Direction::X);
+            auto ix0 = windowStart(this->layout_->physicalStartIndex(Ex, Direction::X), xLower);
+            auto ix1 = windowEnd(this->layout_->physicalEndIndex(Ex, Direction::X), xUpper);
             auto iy0 = this->layout_->physicalStartIndex(Ex, Direction::Y);
             auto iy1 = this->layout_->physicalEndIndex(Ex, Direction::Y);
 
@@ -308,8 +312,8 @@ namespace core
                 }
             }
 
-            ix0 = this->layout_->physicalStartIndex(Ey, Direction::X);
-            ix1 = this->layout_->physicalEndIndex(Ey, Direction::X);
+            ix0 = windowStart(this->layout_->physicalStartIndex(Ey, Direction::X), xLower);
+            ix1 = windowEnd(this->layout_->physicalEndIndex(Ey, Direction::X), xUpper);
             iy0 = this->layout_->physicalStartIndex(Ey, Direction::Y);
             iy1 = this->layout_->physicalEndIndex(Ey, Direction::Y);
 
@@ -324,8 +328,8 @@ namespace core
                 }
             }
 
-            ix0 = this->layout_->physicalStartIndex(Ez, Direction::X);
-            ix1 = this->layout_->physicalEndIndex(Ez, Direction::X);
+            ix0 = windowStart(this->layout_->physicalStartIndex(Ez, Direction::X), xLower);
+            ix1 = windowEnd(this->layout_->physicalEndIndex(Ez, Direction::X), xUpper);
             iy0 = this->layout_->physicalStartIndex(Ez, Direction::Y);
             iy1 = this->layout_->physicalEndIndex(Ez, Direction::Y);
 
@@ -498,14 +502,14 @@ namespace core
     public:
         template<typename Field, typename VecField>
         void operator()(Field const& n, VecField const& Ve, Field const& Pe, VecField const& B,
-                        VecField const& J, VecField& Enew)
+                        VecField const& J, VecField& Enew, uint32 xLower, uint32 xUpper)
         {
             auto& Ex = Enew.getComponent(Component::X);
             auto& Ey = Enew.getComponent(Component::Y);
             auto& Ez = Enew.getComponent(Component::Z);
 
-            auto ix0 = this->layout_->physicalStartIndex(Ex, Direction::X);
-            auto ix1 = this->layout_->physicalEndIndex(Ex, Direction::X);
+            auto ix0 = windowStart(this->layout_->physicalStartIndex(Ex, Direction::X), xLower);
+            auto ix1 = windowEnd(this->layout_->physicalEndIndex(Ex, Direction::X), xUpper);
             auto iy0 = this->layout_->physicalStartIndex(Ex, Direction::Y);
             auto iy1 = this->layout_->physicalEndIndex(Ex, Direction::Y);
             auto iz0 = this->layout_->physicalStartIndex(Ex, Direction::Z);
@@ -526,8 +530,8 @@ namespace core
                 }
             }
 
-            ix0 = this->layout_->physicalStartIndex(Ey, Direction::X);
-            ix1 = this->layout_->physicalEndIndex(Ey, Direction::X);
+            ix0 = windowStart(this->layout_->physicalStartIndex(Ey, Direction::X), xLower);
+            ix1 = windowEnd(this->layout_->physicalEndIndex(Ey, Direction::X), xUpper);
             iy0 = this->layout_->physicalStartIndex(Ey, Direction::Y);
             iy1 = this->layout_->physicalEndIndex(Ey, Direction::Y);
             iz0 = this->layout_->physicalStartIndex(Ey, Direction::Z);
@@ -548,8 +552,8 @@ namespace core
                 }
             }
 
-            ix0 = this->layout_->physicalStartIndex(Ez, Direction::X);
-            ix1 = this->layout_->physicalEndIndex(Ez, Direction::X);
+            ix0 = windowStart(this->layout_->physicalStartIndex(Ez, Direction::X), xLower);
+            ix1 = windowEnd(this->layout_->physicalEndIndex(Ez, Direction::X), xUpper);
             iy0 = this->layout_->physicalStartIndex(Ez, Direction::Y);
             iy1 = this->layout_->physicalEndIndex(Ez, Direction::Y);
             iz0 = this->layout_->physicalStartIndex(Ez, Direction::Z);
@@ -741,7 +745,7 @@ namespace core
                     "Error - Ohm - GridLayout not set, cannot proceed to calculate ohm()");
             }
 
-            impl_(n, Ve, Pe, B, J, Enew);
+            impl_(n, Ve, Pe, B, J, Enew, 0, std::numeric_limits<uint32>::max());
         }
 
 
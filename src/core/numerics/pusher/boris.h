@@ -1,10 +1,12 @@
 #ifndef PHARE_CORE_PUSHER_BORIS_H
 #define PHARE_CORE_PUSHER_BORIS_H
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 
+#include "numerics/pusher/boris_simd.h"
 #include "numerics/pusher/pusher.h"
 #include "utilities/range/range.h"
 
@@ -12,8 +14,15 @@ namespace PHARE
 {
 namespace core
 {
+    /** @brief BorisPusher implements the Boris scheme.
+     *
+     * If useSimd is true, the velocity update is done on batches of borisBatchSize
+     * particles (see boris_simd.h), otherwise one particle at a time.
+     * The default is given by the 'boris_simd' CMake option (PHARE_BORIS_SIMD).
+     */
     template<std::size_t dim, typename ParticleIterator, typename Electromag, typename Interpolator,
-             typename ParticleSelector, typename BoundaryCondition>
+             typename ParticleSelector, typename BoundaryCondition,
+             bool useSimd = borisSimdByDefault>
     class BorisPusher : public Pusher<dim, ParticleIterator, Electromag, Interpolator,
                                       ParticleSelector, BoundaryCondition>
     {
@@ -30,7 +39,7 @@ namespace core
             // push the particles of half a step
             // rangeIn : t=n, rangeOut : t=n+1/Z
             // get a pointer on the first particle of rangeOut that leaves the patch
-            auto firstLeaving = pushStep_(rangeIn, rangeOut, particleIsNotLeaving);
+            auto firstLeaving = pushStep_<true>(rangeIn, rangeOut, particleIsNotLeaving);
 
             // apply boundary condition on the particles in [firstLeaving, rangeOut.end[
             // that actually leave through a physical boundary condition
@@ -50,7 +59,7 @@ namespace core
 
             // now advance the particles from t=n+1/2 to t=n+1 using v_{n+1} just calculated
             // and get a pointer to the first leaving particle
-            firstLeaving = pushStep_(rangeOut, rangeOut, particleIsNotLeaving);
+            firstLeaving = pushStep_<false>(rangeOut, rangeOut, particleIsNotLeaving);
 
             // apply BC on the leaving particles that leave through physical BC
             // and get pointer on new End, discarding particles leaving elsewhere
@@ -71,7 +80,7 @@ namespace core
             // push the particles of half a step
             // rangeIn : t=n, rangeOut : t=n+1/Z
             // get a pointer on the first particle of rangeOut that leaves the patch
-            auto firstLeaving = pushStep_(rangeIn, rangeOut, particleIsNotLeaving);
+            auto firstLeaving = pushStep_<true>(rangeIn, rangeOut, particleIsNotLeaving);
 
             rangeOut = makeRange(rangeOut.begin(), std::move(firstLeaving));
 
@@ -84,7 +93,7 @@ namespace core
 
             // now advance the particles from t=n+1/2 to t=n+1 using v_{n+1} just calculated
             // and get a pointer to the first leaving particle
-            firstLeaving = pushStep_(rangeOut, rangeOut, particleIsNotLeaving);
+            firstLeaving = pushStep_<false>(rangeOut, rangeOut, particleIsNotLeaving);
 
             rangeOut = makeRange(rangeOut.begin(), std::move(firstLeaving));
 
@@ -105,8 +114,8 @@ namespace core
     private:
         /** move the particle partIn of half a time step and store it in partOut
          */
-        template<typename ParticleIter>
-        void advancePosition_(ParticleIter const& partIn, ParticleIter& partOut)
+        template<typename ParticleIn, typename ParticleOut>
+        void advancePosition_(ParticleIn const& partIn, ParticleOut&& partOut)
         {
             // push the particle
             for (std::size_t iDim = 0; iDim < dim; ++iDim)
@@ -123,49 +132,37 @@ namespace core
 
 
         /** advance the particles in rangeIn of half a time step and store them
-         * in rangeOut.
+         * in rangeOut. With copyParticles, each particle of rangeIn is copied in rangeOut before
+         * being advanced, so that rangeOut does not need to hold the particles of rangeIn.
+         * Otherwise only the positions are written, rangeOut holding the particles of rangeIn.
+         *
+         * All particles are advanced before being partitioned, so that rangeOut may be rangeIn.
          * @return the function returns and iterator on the first leaving particle, as
          * detected by the ParticleSelector
          */
-        template<typename ParticleRangeIn, typename ParticleRangeOut>
+        template<bool copyParticles, typename ParticleRangeIn, typename ParticleRangeOut>
         auto pushStep_(ParticleRangeIn const& rangeIn, ParticleRangeOut& rangeOut,
                        ParticleSelector const& particleIsNotLeaving)
         {
-            auto swapee = rangeOut.end();
-            --swapee;
-            auto newEnd = rangeOut.end();
-
             auto currentOut = rangeOut.begin();
 
-            for (auto currentIn : rangeIn)
+            for (auto currentIn = rangeIn.begin(); currentIn != rangeIn.end();
+                 ++currentIn, ++currentOut)
             {
-                // push the particle
-                advancePosition_(currentIn, *currentOut);
-
-                if (particleIsNotLeaving(*currentOut))
+                if constexpr (copyParticles)
                 {
-                    // we advance the output iterator
-                    // only if currentOut has not been
-                    // swapped
-                    ++currentOut;
+                    *currentOut = *currentIn;
                 }
-                else
-                {
-                    // if the particle satisfies the predicate
-                    // swap it with the swapee
-                    // and decrement the swapee
 
-                    std::swap(*currentOut, *swapee);
-                    --newEnd;
-                    --swapee;
-                }
+                // push the particle
+                advancePosition_(*currentIn, *currentOut);
             }
 
             // now all particles have been pushed
             // those not satisfying the predicate after the push
-            // are found in [newEnd:end[
+            // are placed in [newEnd:end[
             // those for which pred is true are in [firstOut,newEnd[
-            return newEnd;
+            return std::partition(rangeOut.begin(), rangeOut.end(), particleIsNotLeaving);
         }
 
 
@@ -177,6 +174,12 @@ namespace core
         void accelerate_(ParticleRangeIn inputParticles, ParticleRangeOut outputParticles,
                          double mass)
         {
+            if constexpr (useSimd)
+            {
+                accelerateBatched_(inputParticles, outputParticles, mass);
+                return;
+            }
+
             double dto2m = 0.5 * dt_ / mass;
 
             auto currentOut = outputParticles.begin();
@@ -244,6 +247,63 @@ namespace core
 
 
 
+        /** Same as accelerate_ but particles are gathered by batches of borisBatchSize
+         * and their velocity is updated with the SIMD kernel borisAccelerate.
+         * The last batch is padded with zeros and only its valid particles are written back.
+         */
+        template<typename ParticleRangeIn, typename ParticleRangeOut>
+        void accelerateBatched_(ParticleRangeIn inputParticles, ParticleRangeOut outputParticles,
+                                double mass)
+        {
+            double dto2m = 0.5 * dt_ / mass;
+
+            BorisBatch<borisBatchSize> batch{};
+
+            auto currentIn  = inputParticles.begin();
+            auto currentOut = outputParticles.begin();
+            auto remaining  = static_cast<std::size_t>(inputParticles.size());
+
+            while (remaining > 0)
+            {
+                auto nbrInBatch = std::min(remaining, borisBatchSize);
+
+                for (auto i = 0u; i < nbrInBatch; ++i, ++currentIn)
+                {
+                    auto const& particle = *currentIn;
+                    batch.coef[i]        = particle.charge * dto2m;
+                    batch.vx[i]          = particle.v[0];
+                    batch.vy[i]          = particle.v[1];
+                    batch.vz[i]          = particle.v[2];
+                    batch.Ex[i]          = particle.Ex;
+                    batch.Ey[i]          = particle.Ey;
+                    batch.Ez[i]          = particle.Ez;
+                    batch.Bx[i]          = particle.Bx;
+                    batch.By[i]          = particle.By;
+                    batch.Bz[i]          = particle.Bz;
+                }
+
+                // padding lanes of the last batch have coef = 0, which is harmless
+                for (auto i = nbrInBatch; i < borisBatchSize; ++i)
+                {
+                    batch.coef[i] = 0.;
+                }
+
+                borisAccelerate(batch);
+
+                for (auto i = 0u; i < nbrInBatch; ++i, ++currentOut)
+                {
+                    currentOut->v[0] = batch.vx[i];
+                    currentOut->v[1] = batch.vy[i];
+                    currentOut->v[2] = batch.vz[i];
+                }
+
+                remaining -= nbrInBatch;
+            }
+        }
+
+
+
+
         std::array<double, dim> halfDtOverDl_;
         double dt_;
     };
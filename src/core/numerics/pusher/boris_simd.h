@@ -0,0 +1,238 @@
+#ifndef PHARE_CORE_PUSHER_BORIS_SIMD_H
+#define PHARE_CORE_PUSHER_BORIS_SIMD_H
+
+#include <array>
+#include <cstddef>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace PHARE
+{
+namespace core
+{
+    //! number of particles processed at once by the batched Boris velocity update
+    //! this is the number of doubles in the widest SIMD register available
+#if defined(__AVX512F__)
+    constexpr std::size_t borisBatchSize = 8;
+#else
+    constexpr std::size_t borisBatchSize = 4;
+#endif
+
+
+    //! the batched Boris velocity update is used by default if PHARE_BORIS_SIMD is defined
+#ifdef PHARE_BORIS_SIMD
+    constexpr bool borisSimdByDefault = true;
+#else
+    constexpr bool borisSimdByDefault = false;
+#endif
+
+
+
+    /** @brief BorisBatch holds the data of batchSize particles needed by the Boris velocity
+     * update, one contiguous (and aligned) array per quantity, so that the same operation
+     * can be applied to all the particles of the batch with one SIMD instruction.
+     *
+     * coef is the charge * dt / (2 * mass) of each particle.
+     */
+    template<std::size_t batchSize>
+    struct alignas(64) BorisBatch
+    {
+        std::array<double, batchSize> coef;
+        std::array<double, batchSize> vx, vy, vz;
+        std::array<double, batchSize> Ex, Ey, Ez;
+        std::array<double, batchSize> Bx, By, Bz;
+    };
+
+
+
+
+    /** @brief portable version of the batched Boris velocity update.
+     *
+     * This is the exact same rotation matrix formulation and operation order than the scalar
+     * BorisPusher::accelerate_, written as loops over the particles of the batch with a fixed trip
+     * count that compilers vectorize.
+     */
+    template<std::size_t batchSize>
+    void borisAccelerateLanes(BorisBatch<batchSize>& batch)
+    {
+        for (auto i = 0u; i < batchSize; ++i)
+        {
+            double const coef1 = batch.coef[i];
+
+            // 1st half push of the electric field
+            double const velx1 = batch.vx[i] + coef1 * batch.Ex[i];
+            double const vely1 = batch.vy[i] + coef1 * batch.Ey[i];
+            double const velz1 = batch.vz[i] + coef1 * batch.Ez[i];
+
+            // preparing variables for magnetic rotation
+            double const rx = coef1 * batch.Bx[i];
+            double const ry = coef1 * batch.By[i];
+            double const rz = coef1 * batch.Bz[i];
+
+            double const rx2  = rx * rx;
+            double const ry2  = ry * ry;
+            double const rz2  = rz * rz;
+            double const rxry = rx * ry;
+            double const rxrz = rx * rz;
+            double const ryrz = ry * rz;
+
+            double const invDet = 1. / (1. + rx2 + ry2 + rz2);
+
+            double const mxx = 1. + rx2 - ry2 - rz2;
+            double const mxy = 2. * (rxry + rz);
+            double const mxz = 2. * (rxrz - ry);
+
+            double const myx = 2. * (rxry - rz);
+            double const myy = 1. + ry2 - rx2 - rz2;
+            double const myz = 2. * (ryrz + rx);
+
+            double const mzx = 2. * (rxrz + ry);
+            double const mzy = 2. * (ryrz - rx);
+            double const mzz = 1. + rz2 - rx2 - ry2;
+
+            // magnetic rotation
+            double const velx2 = (mxx * velx1 + mxy * vely1 + mxz * velz1) * invDet;
+            double const vely2 = (myx * velx1 + myy * vely1 + myz * velz1) * invDet;
+            double const velz2 = (mzx * velx1 + mzy * vely1 + mzz * velz1) * invDet;
+
+            // 2nd half push of the electric field
+            batch.vx[i] = velx2 + coef1 * batch.Ex[i];
+            batch.vy[i] = vely2 + coef1 * batch.Ey[i];
+            batch.vz[i] = velz2 + coef1 * batch.Ez[i];
+        }
+    }
+
+
+
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+
+    /** @brief SIMD version of the batched Boris velocity update.
+     *
+     * Vec gives the register type and the intrinsics for the instruction set. Multiplications
+     * and additions are kept separate (no FMA) and in the scalar order so that the result is
+     * identical to the scalar path.
+     */
+    template<typename Vec, std::size_t batchSize>
+    void borisAccelerateSimd(BorisBatch<batchSize>& batch)
+    {
+        using reg = typename Vec::reg;
+
+        reg const one = Vec::set1(1.);
+        reg const two = Vec::set1(2.);
+
+        reg const coef1 = Vec::load(batch.coef.data());
+        reg const Ex    = Vec::load(batch.Ex.data());
+        reg const Ey    = Vec::load(batch.Ey.data());
+        reg const Ez    = Vec::load(batch.Ez.data());
+
+        reg const velx1 = Vec::add(Vec::load(batch.vx.data()), Vec::mul(coef1, Ex));
+        reg const vely1 = Vec::add(Vec::load(batch.vy.data()), Vec::mul(coef1, Ey));
+        reg const velz1 = Vec::add(Vec::load(batch.vz.data()), Vec::mul(coef1, Ez));
+
+        reg const rx = Vec::mul(coef1, Vec::load(batch.Bx.data()));
+        reg const ry = Vec::mul(coef1, Vec::load(batch.By.data()));
+        reg const rz = Vec::mul(coef1, Vec::load(batch.Bz.data()));
+
+        reg const rx2  = Vec::mul(rx, rx);
+        reg const ry2  = Vec::mul(ry, ry);
+        reg const rz2  = Vec::mul(rz, rz);
+        reg const rxry = Vec::mul(rx, ry);
+        reg const rxrz = Vec::mul(rx, rz);
+        reg const ryrz = Vec::mul(ry, rz);
+
+        reg const invDet = Vec::div(one, Vec::add(Vec::add(Vec::add(one, rx2), ry2), rz2));
+
+        reg const mxx = Vec::sub(Vec::sub(Vec::add(one, rx2), ry2), rz2);
+        reg const mxy = Vec::mul(two, Vec::add(rxry, rz));
+        reg const mxz = Vec::mul(two, Vec::sub(rxrz, ry));
+
+        reg const myx = Vec::mul(two, Vec::sub(rxry, rz));
+        reg const myy = Vec::sub(Vec::sub(Vec::add(one, ry2), rx2), rz2);
+        reg const myz = Vec::mul(two, Vec::add(ryrz, rx));
+
+        reg const mzx = Vec::mul(two, Vec::add(rxrz, ry));
+        reg const mzy = Vec::mul(two, Vec::sub(ryrz, rx));
+        reg const mzz = Vec::sub(Vec::sub(Vec::add(one, rz2), rx2), ry2);
+
+        auto rotate = [&](reg const& m1, reg const& m2, reg const& m3) {
+            return Vec::mul(
+                Vec::add(Vec::add(Vec::mul(m1, velx1), Vec::mul(m2, vely1)), Vec::mul(m3, velz1)),
+                invDet);
+        };
+
+        reg const velx2 = rotate(mxx, mxy, mxz);
+        reg const vely2 = rotate(myx, myy, myz);
+        reg const velz2 = rotate(mzx, mzy, mzz);
+
+        Vec::store(batch.vx.data(), Vec::add(velx2, Vec::mul(coef1, Ex)));
+        Vec::store(batch.vy.data(), Vec::add(vely2, Vec::mul(coef1, Ey)));
+        Vec::store(batch.vz.data(), Vec::add(velz2, Vec::mul(coef1, Ez)));
+    }
+
+#endif
+
+
+#if defined(__AVX2__)
+    struct AVX2Vec
+    {
+        using reg = __m256d;
+        static reg set1(double x) { return _mm256_set1_pd(x); }
+        static reg load(double const* p) { return _mm256_load_pd(p); }
+        static void store(double* p, reg x) { _mm256_store_pd(p, x); }
+        static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+        static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+        static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+        static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    };
+#endif
+
+
+#if defined(__AVX512F__)
+    struct AVX512Vec
+    {
+        using reg = __m512d;
+        static reg set1(double x) { return _mm512_set1_pd(x); }
+        static reg load(double const* p) { return _mm512_load_pd(p); }
+        static void store(double* p, reg x) { _mm512_store_pd(p, x); }
+        static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+        static reg sub(reg a, reg b) { return _mm512_sub_pd(a, b); }
+        static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+        static reg div(reg a, reg b) { return _mm512_div_pd(a, b); }
+    };
+#endif
+
+
+
+
+    /** @brief borisAccelerate updates the velocity of the batchSize particles of the batch,
+     * using AVX-512 or AVX2 instructions when the batch fits in a register of the instruction
+     * set the code is compiled for, and the portable version otherwise.
+     */
+    template<std::size_t batchSize>
+    void borisAccelerate(BorisBatch<batchSize>& batch)
+    {
+#if defined(__AVX512F__)
+        if constexpr (batchSize == 8)
+        {
+            borisAccelerateSimd<AVX512Vec>(batch);
+            return;
+        }
+#endif
+#if defined(__AVX2__)
+        if constexpr (batchSize == 4)
+        {
+            borisAccelerateSimd<AVX2Vec>(batch);
+            return;
+        }
+#endif
+        borisAccelerateLanes(batch);
+    }
+
+
+} // namespace core
+} // namespace PHARE
+
+#endif
@@ -26,8 +26,9 @@ namespace core
          * is false. The pivot is the iterator separating the two parts. Here it is assumed
          * the selector returns true for particles staying in the patch and false otherwise.
          *
-         * move() assumes that particles in rangeIn and those in rangeOut have the same
-         * state upon entering the function.
+         * The particles of rangeIn are copied in rangeOut as they are pushed, so that
+         * rangeIn is left untouched and rangeOut does not need to hold a copy of them upon
+         * entering the function. rangeOut may also be rangeIn, to push particles in place.
          *
          * @param rangeIn : range of iterators on particles at time t=n to be pushed
          * @param rangeOut: output range of iterators on particles at t=n+1. rangeOut
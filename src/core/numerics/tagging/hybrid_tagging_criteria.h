@@ -0,0 +1,360 @@
+#ifndef PHARE_CORE_NUMERICS_TAGGING_HYBRID_TAGGING_CRITERIA_H
+#define PHARE_CORE_NUMERICS_TAGGING_HYBRID_TAGGING_CRITERIA_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "data/grid/gridlayoutdefs.h"
+#include "data/vecfield/vecfield_component.h"
+#include "data_provider.h"
+#include "utilities/point/point.h"
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief TaggingThresholds are the thresholds above which a cell is tagged for refinement.
+     * A threshold of zero disables the corresponding criterion.
+     *
+     * - current: |J|, with J the curl of B
+     * - magneticGradient: the relative variation of B over a cell, |dx.grad(B)| / |B|
+     * - densityGradient: the relative variation of the ion density over a cell, |dx.grad(n)| / n
+     * - particlesPerCell: the number of domain particles of all populations in the cell
+     */
+    struct TaggingThresholds
+    {
+        double current               = 0.;
+        double magneticGradient      = 0.;
+        double densityGradient       = 0.;
+        std::size_t particlesPerCell = 0;
+    };
+
+
+
+
+    /** @brief HybridTaggingCriteria finds the cells of a patch the hybrid model state needs to
+     * be refined on, according to TaggingThresholds.
+     *
+     * Fields are evaluated at cell centers: primal quantities are averaged over the two nodes
+     * bounding the cell, and derivatives are taken over the cell for primal quantities and over
+     * the two neighbouring cells for dual ones.
+     */
+    template<typename GridLayout>
+    class HybridTaggingCriteria
+    {
+    public:
+        static constexpr auto dimension = GridLayout::dimension;
+
+        explicit HybridTaggingCriteria(TaggingThresholds const& thresholds)
+            : thresholds_{thresholds}
+        {
+        }
+
+
+        /** builds the criteria from a dictionary with the keys "current", "magneticGradient",
+         * "densityGradient" (double) and "particlesPerCell" (std::size_t).
+         */
+        explicit HybridTaggingCriteria(PHARE::initializer::PHAREDict<dimension> dict)
+            : thresholds_{dict["current"].template to<double>(),
+                          dict["magneticGradient"].template to<double>(),
+                          dict["densityGradient"].template to<double>(),
+                          dict["particlesPerCell"].template to<std::size_t>()}
+        {
+        }
+
+
+
+        TaggingThresholds const& thresholds() const { return thresholds_; }
+
+
+
+        /** calls tag(cell) with the AMR index of each physical cell of the layout that meets at
+         * least one of the criteria, given the magnetic field and the ions on the patch.
+         */
+        template<typename VecField, typename Ions, typename Tag>
+        void tag(GridLayout const& layout, VecField const& B, Ions& ions, Tag&& tag) const
+        {
+            std::vector<std::size_t> particleCounts;
+            if (thresholds_.particlesPerCell > 0)
+            {
+                particleCounts.assign(nbrPhysicalCells_(layout), 0);
+                for (auto& pop : ions)
+                {
+                    countParticles(layout, pop.domainParticles(), particleCounts);
+                }
+            }
+
+            tagCells(layout, B, ions.density(), particleCounts, std::forward<Tag>(tag));
+        }
+
+
+
+        /** adds the number of particles in each physical cell of the layout to counts, which
+         * has one element per physical cell, in row major order. Particles outside the physical
+         * cells are not counted.
+         */
+        template<typename ParticleArray>
+        static void countParticles(GridLayout const& layout, ParticleArray const& particles,
+                                   std::vector<std::size_t>& counts)
+        {
+            auto const nbrCells  = layout.nbrCells();
+            auto const firstCell = static_cast<int>(
+                layout.physicalStartIndex(QtyCentering::dual, Direction::X));
+
+            for (auto const& particle : particles)
+            {
+                auto localCell = layout.AMRToLocal(Point<int, dimension>{particle.iCell});
+
+                std::size_t cellIndex = 0;
+                bool isInside         = true;
+                for (auto iDim = 0u; iDim < dimension; ++iDim)
+                {
+                    auto cell = localCell[iDim] - firstCell;
+                    isInside  = isInside && cell >= 0 && cell < static_cast<int>(nbrCells[iDim]);
+                    cellIndex = cellIndex * nbrCells[iDim] + static_cast<std::size_t>(cell);
+                }
+
+                if (isInside)
+                {
+                    ++counts[cellIndex];
+                }
+            }
+        }
+
+
+
+        /** calls tag(cell) with the AMR index of each physical cell meeting at least one of the
+         * criteria. particleCounts is as filled by countParticles(), and is not used if empty.
+         */
+        template<typename VecField, typename Field, typename Tag>
+        void tagCells(GridLayout const& layout, VecField const& B, Field const& density,
+                      std::vector<std::size_t> const& particleCounts, Tag&& tag) const
+        {
+            auto const nbrCells  = layout.nbrCells();
+            auto const firstCell = static_cast<int>(
+                layout.physicalStartIndex(QtyCentering::dual, Direction::X));
+
+            std::array<std::uint32_t, dimension> cell{};
+            std::size_t cellIndex = 0;
+
+            auto tagIfNeeded = [&]() {
+                if (mustTag_(layout, B, density, particleCounts, cell, cellIndex))
+                {
+                    Point<int, dimension> localCell;
+                    for (auto iDim = 0u; iDim < dimension; ++iDim)
+                    {
+                        localCell[iDim] = firstCell + static_cast<int>(cell[iDim]);
+                    }
+                    tag(layout.localToAMR(localCell));
+                }
+                ++cellIndex;
+            };
+
+            for (cell[0] = 0; cell[0] < nbrCells[0]; ++cell[0])
+            {
+                if constexpr (dimension == 1)
+                {
+                    tagIfNeeded();
+                }
+                else
+                {
+                    for (cell[1] = 0; cell[1] < nbrCells[1]; ++cell[1])
+                    {
+                        if constexpr (dimension == 2)
+                        {
+                            tagIfNeeded();
+                        }
+                        else if constexpr (dimension == 3)
+                        {
+                            for (cell[2] = 0; cell[2] < nbrCells[2]; ++cell[2])
+                            {
+                                tagIfNeeded();
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+
+
+    private:
+        TaggingThresholds thresholds_;
+
+        using Cell = std::array<std::uint32_t, dimension>;
+
+        static constexpr int noDerivative = -1;
+
+
+
+        static std::size_t nbrPhysicalCells_(GridLayout const& layout)
+        {
+            std::size_t nbrCells = 1;
+            for (auto n : layout.nbrCells())
+            {
+                nbrCells *= n;
+            }
+            return nbrCells;
+        }
+
+
+
+        template<typename VecField, typename Field>
+        bool mustTag_(GridLayout const& layout, VecField const& B, Field const& density,
+                      std::vector<std::size_t> const& particleCounts, Cell const& cell,
+                      std::size_t cellIndex) const
+        {
+            if (thresholds_.particlesPerCell > 0 && !particleCounts.empty()
+                && particleCounts[cellIndex] > thresholds_.particlesPerCell)
+            {
+                return true;
+            }
+
+            auto const meshSize = layout.meshSize();
+
+            if (thresholds_.current > 0. || thresholds_.magneticGradient > 0.)
+            {
+                // dB[iComp][iDim] is the derivative of the component iComp along iDim
+                std::array<std::array<double, 3>, 3> dB{};
+                std::array<double, 3> cellB;
+
+                std::array<Component, 3> const components{
+                    {Component::X, Component::Y, Component::Z}};
+                for (auto iComp = 0u; iComp < 3; ++iComp)
+                {
+                    auto const& Bi = B.getComponent(components[iComp]);
+                    cellB[iComp]   = atCellCenter_(layout, Bi, cell, noDerivative);
+                    for (auto iDim = 0u; iDim < dimension; ++iDim)
+                    {
+                        dB[iComp][iDim] = atCellCenter_(layout, Bi, cell, static_cast<int>(iDim));
+                    }
+                }
+
+                if (thresholds_.current > 0.)
+                {
+                    auto Jx = dB[2][1] - dB[1][2];
+                    auto Jy = dB[0][2] - dB[2][0];
+                    auto Jz = dB[1][0] - dB[0][1];
+
+                    if (std::sqrt(Jx * Jx + Jy * Jy + Jz * Jz) > thresholds_.current)
+                        return true;
+                }
+
+                if (thresholds_.magneticGradient > 0.)
+                {
+                    double variation2 = 0.;
+                    double norm2      = 0.;
+                    for (auto iComp = 0u; iComp < 3; ++iComp)
+                    {
+                        norm2 += cellB[iComp] * cellB[iComp];
+                        for (auto iDim = 0u; iDim < dimension; ++iDim)
+                        {
+                            auto variation = meshSize[iDim] * dB[iComp][iDim];
+                            variation2 += variation * variation;
+                        }
+                    }
+
+                    if (std::sqrt(variation2) > thresholds_.magneticGradient * std::sqrt(norm2))
+                        return true;
+                }
+            }
+
+            if (thresholds_.densityGradient > 0.)
+            {
+                double variation2 = 0.;
+                for (auto iDim = 0u; iDim < dimension; ++iDim)
+                {
+                    auto variation = meshSize[iDim]
+                                     * atCellCenter_(layout, density, cell, static_cast<int>(iDim));
+                    variation2 += variation * variation;
+                }
+
+                auto n = atCellCenter_(layout, density, cell, noDerivative);
+                if (std::sqrt(variation2) > thresholds_.densityGradient * std::abs(n))
+                    return true;
+            }
+
+            return false;
+        }
+
+
+
+        /** @return the value of the field at the center of the cell, or its derivative along
+         * derivativeDirection if it is not noDerivative.
+         */
+        template<typename Field>
+        static double atCellCenter_(GridLayout const& layout, Field const& field, Cell const& cell,
+                                    int derivativeDirection)
+        {
+            auto const centering       = GridLayout::centering(field.physicalQuantity());
+            auto const inverseMeshSize = layout.inverseMeshSize();
+
+            std::array<std::uint32_t, dimension> node;
+            std::array<std::array<int, 2>, dimension> offsets;
+            std::array<std::array<double, 2>, dimension> weights;
+
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                bool const isPrimal = centering[iDim] == QtyCentering::primal;
+                node[iDim]
+                    = layout.physicalStartIndex(centering[iDim], static_cast<Direction>(iDim))
+                      + cell[iDim];
+
+                if (static_cast<int>(iDim) == derivativeDirection)
+                {
+                    auto const h  = inverseMeshSize[iDim];
+                    offsets[iDim] = isPrimal ? std::array<int, 2>{{0, 1}}
+                                             : std::array<int, 2>{{-1, 1}};
+                    weights[iDim] = isPrimal ? std::array<double, 2>{{-h, h}}
+                                             : std::array<double, 2>{{-0.5 * h, 0.5 * h}};
+                }
+                else
+                {
+                    offsets[iDim] = isPrimal ? std::array<int, 2>{{0, 1}}
+                                             : std::array<int, 2>{{0, 0}};
+                    weights[iDim] = {{0.5, 0.5}};
+                }
+            }
+
+            auto at = [&](std::size_t iDim, std::size_t i) {
+                return static_cast<std::uint32_t>(static_cast<int>(node[iDim]) + offsets[iDim][i]);
+            };
+
+            double value = 0.;
+            for (auto i = 0u; i < 2; ++i)
+            {
+                if constexpr (dimension == 1)
+                {
+                    value += weights[0][i] * field(at(0, i));
+                }
+                else
+                {
+                    for (auto j = 0u; j < 2; ++j)
+                    {
+                        if constexpr (dimension == 2)
+                        {
+                            value += weights[0][i] * weights[1][j] * field(at(0, i), at(1, j));
+                        }
+                        else if constexpr (dimension == 3)
+                        {
+                            for (auto k = 0u; k < 2; ++k)
+                            {
+                                value += weights[0][i] * weights[1][j] * weights[2][k]
+                                         * field(at(0, i), at(1, j), at(2, k));
+                            }
+                        }
+                    }
+                }
+            }
+            return value;
+        }
+    };
+
+} // namespace core
+} // namespace PHARE
+
+#endif
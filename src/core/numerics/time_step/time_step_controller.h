@@ -0,0 +1,281 @@
+#ifndef PHARE_CORE_NUMERICS_TIME_STEP_TIME_STEP_CONTROLLER_H
+#define PHARE_CORE_NUMERICS_TIME_STEP_TIME_STEP_CONTROLLER_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include "data/grid/gridlayoutdefs.h"
+#include "data/vecfield/vecfield_component.h"
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief TimeStepRates holds the largest rates (inverse of times) of the processes a hybrid
+     * time step must resolve:
+     *
+     * - particles: the rate at which the fastest particle crosses cells, sum_i |v_i|/dx_i
+     * - whistler: the frequency of the whistler wave at the grid scale, k^2 |B|/n with
+     * k^2 = sum_i (pi/dx_i)^2
+     * - gyration: the largest ion gyrofrequency |q||B|/m
+     *
+     * Rates of patches, levels or MPI ranks are combined taking their maximum, so a rate of
+     * zero means that nothing constrains the time step.
+     */
+    struct TimeStepRates
+    {
+        double particles = 0.;
+        double whistler  = 0.;
+        double gyration  = 0.;
+    };
+
+
+
+    inline TimeStepRates maxRates(TimeStepRates const& rates1, TimeStepRates const& rates2)
+    {
+        return {std::max(rates1.particles, rates2.particles),
+                std::max(rates1.whistler, rates2.whistler),
+                std::max(rates1.gyration, rates2.gyration)};
+    }
+
+
+
+
+    /** @brief forEachPhysicalNode calls fn with the value of the field at each of its physical
+     * nodes, i.e. excluding ghost nodes.
+     */
+    template<typename GridLayout, typename Field, typename Fn>
+    void forEachPhysicalNode(GridLayout const& layout, Field const& field, Fn&& fn)
+    {
+        constexpr auto dimension = GridLayout::dimension;
+
+        auto const ix0 = layout.physicalStartIndex(field, Direction::X);
+        auto const ix1 = layout.physicalEndIndex(field, Direction::X);
+
+        if constexpr (dimension == 1)
+        {
+            for (auto ix = ix0; ix <= ix1; ++ix)
+                fn(field(ix));
+        }
+        else
+        {
+            auto const iy0 = layout.physicalStartIndex(field, Direction::Y);
+            auto const iy1 = layout.physicalEndIndex(field, Direction::Y);
+
+            if constexpr (dimension == 2)
+            {
+                for (auto ix = ix0; ix <= ix1; ++ix)
+                    for (auto iy = iy0; iy <= iy1; ++iy)
+                        fn(field(ix, iy));
+            }
+            else if constexpr (dimension == 3)
+            {
+                auto const iz0 = layout.physicalStartIndex(field, Direction::Z);
+                auto const iz1 = layout.physicalEndIndex(field, Direction::Z);
+
+                for (auto ix = ix0; ix <= ix1; ++ix)
+                    for (auto iy = iy0; iy <= iy1; ++iy)
+                        for (auto iz = iz0; iz <= iz1; ++iz)
+                            fn(field(ix, iy, iz));
+            }
+        }
+    }
+
+
+
+
+    /** @brief maxMagneticNorm returns an upper bound of |B| on the physical nodes, built from
+     * the largest absolute value of each component. Components are on different nodes, the
+     * bound avoids interpolating them on common nodes.
+     */
+    template<typename GridLayout, typename VecField>
+    double maxMagneticNorm(GridLayout const& layout, VecField const& B)
+    {
+        double norm2 = 0.;
+        for (auto component : {Component::X, Component::Y, Component::Z})
+        {
+            double maxAbs = 0.;
+            forEachPhysicalNode(layout, B.getComponent(component), [&maxAbs](double value) {
+                maxAbs = std::max(maxAbs, std::abs(value));
+            });
+            norm2 += maxAbs * maxAbs;
+        }
+        return std::sqrt(norm2);
+    }
+
+
+
+
+    //! @return the smallest value of the field on its physical nodes
+    template<typename GridLayout, typename Field>
+    double minPhysicalValue(GridLayout const& layout, Field const& field)
+    {
+        double minValue = std::numeric_limits<double>::max();
+        forEachPhysicalNode(layout, field,
+                            [&minValue](double value) { minValue = std::min(minValue, value); });
+        return minValue;
+    }
+
+
+
+
+    /** @brief maxCellCrossingRate returns the largest sum_i |v_i|/dx_i of the particles, i.e.
+     * the inverse of the time the fastest of them takes to cross a cell.
+     */
+    template<typename ParticleArray, std::size_t dim>
+    double maxCellCrossingRate(ParticleArray const& particles,
+                               std::array<double, dim> const& meshSize)
+    {
+        std::array<double, dim> inverseMeshSize;
+        for (auto iDim = 0u; iDim < dim; ++iDim)
+        {
+            inverseMeshSize[iDim] = 1. / meshSize[iDim];
+        }
+
+        double maxRate = 0.;
+        for (auto const& particle : particles)
+        {
+            double rate = 0.;
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                rate += std::abs(particle.v[iDim]) * inverseMeshSize[iDim];
+            }
+            maxRate = std::max(maxRate, rate);
+        }
+        return maxRate;
+    }
+
+
+
+
+    //! @return the largest |q|/m of the particles of given mass, 0 if there is none
+    template<typename ParticleArray>
+    double maxChargeOverMass(ParticleArray const& particles, double mass)
+    {
+        double maxCharge = 0.;
+        for (auto const& particle : particles)
+        {
+            maxCharge = std::max(maxCharge, std::abs(static_cast<double>(particle.charge)));
+        }
+        return maxCharge / mass;
+    }
+
+
+
+
+    /** @brief timeStepRates computes the TimeStepRates of a patch, given its layout, the
+     * magnetic field and the ions set on it. All the particles pushed during the step are
+     * considered: domain, patch ghost and level ghost particles.
+     *
+     * The whistler rate uses the largest |B| and the smallest ion density of the patch, which
+     * is not smaller than densityFloor, so that nearly empty regions do not make the time step
+     * vanish.
+     */
+    template<typename GridLayout, typename VecField, typename Ions>
+    TimeStepRates timeStepRates(GridLayout const& layout, VecField const& B, Ions& ions,
+                                double densityFloor)
+    {
+        auto const meshSize = layout.meshSize();
+        auto const maxB     = maxMagneticNorm(layout, B);
+
+        TimeStepRates rates;
+
+        for (auto& pop : ions)
+        {
+            for (auto* particles : {&pop.domainParticles(), &pop.patchGhostParticles(),
+                                    &pop.levelGhostParticles()})
+            {
+                rates.particles
+                    = std::max(rates.particles, maxCellCrossingRate(*particles, meshSize));
+                rates.gyration
+                    = std::max(rates.gyration, maxChargeOverMass(*particles, pop.mass()) * maxB);
+            }
+        }
+
+        double const pi = std::acos(-1.);
+        double k2       = 0.;
+        for (auto dx : meshSize)
+        {
+            k2 += (pi / dx) * (pi / dx);
+        }
+        auto const minDensity = std::max(minPhysicalValue(layout, ions.density()), densityFloor);
+        rates.whistler        = k2 * maxB / minDensity;
+
+        return rates;
+    }
+
+
+
+
+    /** @brief TimeStepController turns TimeStepRates into the time step of a level.
+     *
+     * The time step is the largest one such that particles cross at most cfl cells, the
+     * grid scale whistler and the ions gyration rotate by at most cfl and maxGyroAngle radians,
+     * respectively. It is never larger than the maximum time step given by the caller.
+     *
+     * To avoid small oscillations of the time step from one step to the next, the controller
+     * remembers the last time step it returned. A smaller time step is always taken right
+     * away, but a larger one is only taken once it exceeds the last one by more than the
+     * hysteresis fraction. A hysteresis of zero disables this.
+     */
+    class TimeStepController
+    {
+    public:
+        explicit TimeStepController(double cfl = 0.5, double maxGyroAngle = 0.1,
+                                    double hysteresis = 0.1)
+            : cfl_{cfl}
+            , maxGyroAngle_{maxGyroAngle}
+            , hysteresis_{hysteresis}
+        {
+            if (cfl_ <= 0. || maxGyroAngle_ <= 0. || hysteresis_ < 0.)
+            {
+                throw std::runtime_error("Error - invalid time step controller parameters");
+            }
+        }
+
+
+
+        /** @return the time step resolving the given rates, not larger than maxDt.
+         * The returned time step is remembered for the hysteresis.
+         */
+        double dt(TimeStepRates const& rates, double maxDt)
+        {
+            auto candidate = maxDt;
+            if (rates.particles > 0.)
+                candidate = std::min(candidate, cfl_ / rates.particles);
+            if (rates.whistler > 0.)
+                candidate = std::min(candidate, cfl_ / rates.whistler);
+            if (rates.gyration > 0.)
+                candidate = std::min(candidate, maxGyroAngle_ / rates.gyration);
+
+            if (lastDt_ > 0. && candidate > lastDt_ && candidate <= lastDt_ * (1. + hysteresis_))
+            {
+                candidate = lastDt_;
+            }
+
+            lastDt_ = candidate;
+            return candidate;
+        }
+
+
+
+        //! forgets the last time step, the next one is not subject to the hysteresis
+        void reset() { lastDt_ = 0.; }
+
+
+
+    private:
+        double cfl_;
+        double maxGyroAngle_;
+        double hysteresis_;
+        double lastDt_ = 0.;
+    };
+
+} // namespace core
+} // namespace PHARE
+
+#endif
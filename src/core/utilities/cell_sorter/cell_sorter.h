@@ -0,0 +1,209 @@
+#ifndef PHARE_CORE_UTILITIES_CELL_SORTER_CELL_SORTER_H
+#define PHARE_CORE_UTILITIES_CELL_SORTER_CELL_SORTER_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "utilities/box/box.h"
+#include "utilities/point/point.h"
+#include "utilities/range/range.h"
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief CellSorter sorts the particles of a ParticleArray by cell, with a counting sort
+     * on their iCell, so that particles of the same cell are contiguous and cells are stored
+     * in the same order as the field arrays (last direction fastest). Gather and deposit
+     * then access the fields almost sequentially.
+     *
+     * All particles must be in the cell box given at construction, whose upper bound is
+     * excluded (like in isIn()). It is usually the patch box grown by the ghost width.
+     *
+     * After a sort, cellOffsets() gives for each cell the index of its first particle, so that
+     * particles of cell i are in [cellOffsets()[i], cellOffsets()[i+1][. These offsets are only
+     * valid until the particles are moved or the array is modified.
+     *
+     * sortIfNeeded() is meant to be called once per time step. It sorts the particles every
+     * sortInterval calls, or earlier if their disorder() exceeds disorderThreshold.
+     */
+    template<typename ParticleArray>
+    class CellSorter
+    {
+    public:
+        static constexpr std::size_t dimension = ParticleArray::value_type::dimension;
+
+
+        explicit CellSorter(Box<int, dimension> cellBox, std::size_t sortInterval = 1,
+                            double disorderThreshold = 1.)
+            : cellBox_{cellBox}
+            , sortInterval_{sortInterval}
+            , disorderThreshold_{disorderThreshold}
+        {
+            if (sortInterval_ == 0)
+            {
+                throw std::runtime_error("Error - CellSorter sort interval must be > 0");
+            }
+
+            nbrCells_ = 1;
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                if (cellBox_.upper[iDim] <= cellBox_.lower[iDim])
+                {
+                    throw std::runtime_error("Error - CellSorter needs a non empty cell box");
+                }
+                nbrCells_ *= static_cast<std::size_t>(cellBox_.upper[iDim] - cellBox_.lower[iDim]);
+            }
+        }
+
+
+
+        /** sorts the particles by cell, using a counting sort. The cell offset table is
+         * updated and the buffer used to sort is kept for the next sorts.
+         */
+        void sort(ParticleArray& particles)
+        {
+            auto nbrParticles = particles.size();
+
+            cellIndexes_.resize(nbrParticles);
+            cellOffsets_.assign(nbrCells_ + 1, 0);
+
+            // count the particles in each cell, shifted by one so that the
+            // prefix sum directly gives the index of the first particle of each cell
+            for (auto iPart = 0u; iPart < nbrParticles; ++iPart)
+            {
+                auto cell           = cellIndex(particles[iPart].iCell);
+                cellIndexes_[iPart] = cell;
+                ++cellOffsets_[cell + 1];
+            }
+
+            for (auto iCell = 1u; iCell <= nbrCells_; ++iCell)
+            {
+                cellOffsets_[iCell] += cellOffsets_[iCell - 1];
+            }
+
+            sorted_.resize(nbrParticles);
+            cursors_.assign(std::begin(cellOffsets_), std::end(cellOffsets_) - 1);
+
+            // scatter is stable, particles in a cell keep their relative order
+            for (auto iPart = 0u; iPart < nbrParticles; ++iPart)
+            {
+                sorted_[cursors_[cellIndexes_[iPart]]++] = particles[iPart];
+            }
+
+            particles.swap(sorted_);
+            stepsSinceSort_ = 0;
+        }
+
+
+
+        /** counts a new step and sorts the particles if sortInterval steps passed since
+         * the last sort, or if disorder() is larger than the disorder threshold.
+         * @return true if the particles have been sorted
+         */
+        bool sortIfNeeded(ParticleArray& particles)
+        {
+            ++stepsSinceSort_;
+
+            // a disorder is always <= 1 so a threshold of 1 or more disables the check
+            if (stepsSinceSort_ >= sortInterval_
+                || (disorderThreshold_ < 1. && disorder(particles) > disorderThreshold_))
+            {
+                sort(particles);
+                return true;
+            }
+            return false;
+        }
+
+
+
+        /** @return the fraction of pairs of consecutive particles that are not in cell order.
+         * 0 means the particles are sorted.
+         */
+        double disorder(ParticleArray const& particles) const
+        {
+            auto nbrParticles = particles.size();
+            if (nbrParticles < 2)
+            {
+                return 0.;
+            }
+
+            std::size_t nbrUnordered = 0;
+            auto previousCell        = cellIndex(particles[0].iCell);
+
+            for (auto iPart = 1u; iPart < nbrParticles; ++iPart)
+            {
+                auto cell = cellIndex(particles[iPart].iCell);
+                if (cell < previousCell)
+                {
+                    ++nbrUnordered;
+                }
+                previousCell = cell;
+            }
+
+            return static_cast<double>(nbrUnordered) / static_cast<double>(nbrParticles - 1);
+        }
+
+
+
+        //! index of the given AMR cell (a Point or a particle iCell) in the cell offset table
+        template<typename Cell>
+        std::size_t cellIndex(Cell const& iCell) const
+        {
+            std::size_t index = 0;
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                auto lower = cellBox_.lower[iDim];
+                auto upper = cellBox_.upper[iDim];
+
+                if (iCell[iDim] < lower || iCell[iDim] >= upper)
+                {
+                    throw std::runtime_error("Error - particle is outside the CellSorter box");
+                }
+                index = index * static_cast<std::size_t>(upper - lower)
+                        + static_cast<std::size_t>(iCell[iDim] - lower);
+            }
+            return index;
+        }
+
+
+
+        //! particles of cell i are in [cellOffsets()[i], cellOffsets()[i+1][ after a sort
+        std::vector<std::size_t> const& cellOffsets() const { return cellOffsets_; }
+
+
+
+        //! @return the range of the particles of the given AMR cell, after a sort
+        template<typename Array>
+        auto cellRange(Array& particles, Point<int, dimension> const& cell) const
+        {
+            auto index = cellIndex(cell);
+            return makeRange(std::begin(particles) + cellOffsets_[index],
+                             std::begin(particles) + cellOffsets_[index + 1]);
+        }
+
+
+
+        std::size_t nbrCells() const { return nbrCells_; }
+
+
+    private:
+        Box<int, dimension> cellBox_;
+        std::size_t sortInterval_;
+        double disorderThreshold_;
+        std::size_t nbrCells_;
+        std::size_t stepsSinceSort_ = 0;
+
+        std::vector<std::size_t> cellOffsets_;
+
+        // buffers kept between sorts to avoid reallocations
+        std::vector<std::size_t> cellIndexes_;
+        std::vector<std::size_t> cursors_;
+        ParticleArray sorted_;
+    };
+
+} // namespace core
+} // namespace PHARE
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef PHARE_CORE_UTILITIES_INDEX_INDEX_H
 #define PHARE_CORE_UTILITIES_INDEX_INDEX_H
 
+#include <algorithm>
 #include <cstddef>
+#include <type_traits>
 
 #include "data/grid/gridlayoutdefs.h"
 #include "utilities/point/point.h"
@@ -73,6 +75,34 @@ namespace core
     MeshIndex<3> make_index(uint32 i, uint32 j, uint32 k);
 
 
+
+    //! @return the first index of a loop starting at start restricted to indexes >= lower
+    template<typename Index>
+    Index windowStart(Index start, uint32 lower)
+    {
+        return static_cast<Index>(std::max<std::common_type_t<Index, uint32>>(start, lower));
+    }
+
+
+    //! @return the last index of a loop ending at end restricted to indexes <= upper
+    template<typename Index>
+    Index windowEnd(Index end, uint32 upper)
+    {
+        return static_cast<Index>(std::min<std::common_type_t<Index, uint32>>(end, upper));
+    }
+
+
+
+    //! @return the box of indexes restricted to X indexes in [lower, upper]
+    template<typename Box>
+    Box xWindow(Box box, uint32 lower, uint32 upper)
+    {
+        box.lower[0] = windowStart(box.lower[0], lower);
+        box.upper[0] = windowEnd(box.upper[0], upper);
+        return box;
+    }
+
+
 } // namespace core
 } // namespace PHARE
 
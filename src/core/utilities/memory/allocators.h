@@ -0,0 +1,139 @@
+#ifndef PHARE_CORE_UTILITIES_MEMORY_ALLOCATORS_H
+#define PHARE_CORE_UTILITIES_MEMORY_ALLOCATORS_H
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief AlignedAllocator is a std allocator returning memory aligned on alignment bytes,
+     * 64 by default, the size of a cache line and of an AVX-512 register.
+     */
+    template<typename T, std::size_t alignment = 64>
+    class AlignedAllocator
+    {
+        static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0,
+                      "alignment must be a power of 2 at least as large as alignof(T)");
+
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template<typename U>
+        AlignedAllocator(AlignedAllocator<U, alignment> const&) noexcept
+        {
+        }
+
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignment}));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t{alignment});
+        }
+    };
+
+    template<typename T, typename U, std::size_t alignment>
+    bool operator==(AlignedAllocator<T, alignment> const&, AlignedAllocator<U, alignment> const&)
+    {
+        return true;
+    }
+
+    template<typename T, typename U, std::size_t alignment>
+    bool operator!=(AlignedAllocator<T, alignment> const&, AlignedAllocator<U, alignment> const&)
+    {
+        return false;
+    }
+
+
+
+
+    /** @brief HugePageAllocator allocates large arrays on 2MB boundaries and asks the kernel to
+     * back them with transparent huge pages, which saves TLB misses when sweeping large patches.
+     * Arrays smaller than a huge page are allocated as with AlignedAllocator. Where huge pages
+     * are not available, the memory is only aligned.
+     */
+    template<typename T>
+    class HugePageAllocator
+    {
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+        static constexpr std::size_t alignment    = 64;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = HugePageAllocator<U>;
+        };
+
+        HugePageAllocator() = default;
+
+        template<typename U>
+        HugePageAllocator(HugePageAllocator<U> const&) noexcept
+        {
+        }
+
+
+        T* allocate(std::size_t n)
+        {
+            auto const bytes = n * sizeof(T);
+            if (bytes < hugePageSize)
+            {
+                return static_cast<T*>(::operator new(bytes, std::align_val_t{alignment}));
+            }
+
+            auto* p = ::operator new(bytes, std::align_val_t{hugePageSize});
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            // only a hint, the memory is usable whether it is honored or not
+            ::madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            if (n * sizeof(T) < hugePageSize)
+            {
+                ::operator delete(p, std::align_val_t{alignment});
+            }
+            else
+            {
+                ::operator delete(p, std::align_val_t{hugePageSize});
+            }
+        }
+    };
+
+    template<typename T, typename U>
+    bool operator==(HugePageAllocator<T> const&, HugePageAllocator<U> const&)
+    {
+        return true;
+    }
+
+    template<typename T, typename U>
+    bool operator!=(HugePageAllocator<T> const&, HugePageAllocator<U> const&)
+    {
+        return false;
+    }
+
+} // namespace core
+} // namespace PHARE
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef PHARE_CORE_UTILITIES_MEMORY_MEMORY_POOL_H
+#define PHARE_CORE_UTILITIES_MEMORY_MEMORY_POOL_H
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace PHARE
+{
+namespace core
+{
+    //! counters of a MemoryPool
+    struct MemoryPoolStatistics
+    {
+        std::size_t hits            = 0; //!< acquire() calls served with a retained buffer
+        std::size_t misses          = 0; //!< acquire() calls that found no retained buffer
+        std::size_t dropped         = 0; //!< buffers freed because the pool was full
+        std::size_t buffersRetained = 0; //!< buffers currently kept by the pool
+        std::size_t bytesRetained   = 0; //!< bytes of the buffers currently kept by the pool
+
+        double hitRate() const
+        {
+            auto const requests = hits + misses;
+            return requests == 0 ? 0. : static_cast<double>(hits) / requests;
+        }
+    };
+
+
+
+
+    /** @brief MemoryPool keeps released buffers so that they can be handed back, with their
+     * memory, to a later acquire() of the same size class Key, instead of being freed and
+     * allocated again.
+     *
+     * Buffer is any movable container, e.g. a std::vector, whose memory follows it when moved.
+     * At most maxBytesRetained bytes are kept, buffers released beyond are freed. The default
+     * only needs to hold the buffers freed by a regrid until the new patches take them, and
+     * keeps a pool from holding on to the memory of levels that are never created again. The
+     * pool is thread safe.
+     */
+    template<typename Key, typename Buffer>
+    class MemoryPool
+    {
+    public:
+        static constexpr std::size_t defaultMaxBytesRetained = std::size_t{1} << 30;
+
+        explicit MemoryPool(std::size_t maxBytesRetained = defaultMaxBytesRetained)
+            : maxBytesRetained_{maxBytesRetained}
+        {
+        }
+
+        MemoryPool(MemoryPool const&) = delete;
+        MemoryPool& operator=(MemoryPool const&) = delete;
+
+
+
+        //! returns a buffer released with key if there is one, a default constructed one if not
+        Buffer acquire(Key const& key)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+
+            auto sizeClass = buffers_.find(key);
+            if (sizeClass == std::end(buffers_) || sizeClass->second.empty())
+            {
+                ++statistics_.misses;
+                return Buffer{};
+            }
+
+            auto retained = std::move(sizeClass->second.back());
+            sizeClass->second.pop_back();
+
+            ++statistics_.hits;
+            --statistics_.buffersRetained;
+            statistics_.bytesRetained -= retained.second;
+
+            return std::move(retained.first);
+        }
+
+
+
+        //! gives buffer, which holds bytes bytes, to the pool. Empty buffers are ignored.
+        void release(Key const& key, Buffer&& buffer, std::size_t bytes)
+        {
+            if (bytes == 0)
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock{mutex_};
+
+            if (bytes > maxBytesRetained_ - statistics_.bytesRetained)
+            {
+                ++statistics_.dropped;
+                return;
+            }
+
+            buffers_[key].emplace_back(std::move(buffer), bytes);
+
+            ++statistics_.buffersRetained;
+            statistics_.bytesRetained += bytes;
+        }
+
+
+
+        //! frees all retained buffers, counters of hits, misses and drops are kept
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+
+            buffers_.clear();
+            statistics_.buffersRetained = 0;
+            statistics_.bytesRetained   = 0;
+        }
+
+
+
+        //! sets the maximum number of retained bytes, freeing retained buffers if needed
+        void setMaxBytesRetained(std::size_t maxBytesRetained)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+
+            maxBytesRetained_ = maxBytesRetained;
+
+            for (auto& [key, retained] : buffers_)
+            {
+                (void)key;
+                while (!retained.empty() && statistics_.bytesRetained > maxBytesRetained_)
+                {
+                    statistics_.bytesRetained -= retained.back().second;
+                    --statistics_.buffersRetained;
+                    ++statistics_.dropped;
+                    retained.pop_back();
+                }
+            }
+        }
+
+
+
+        MemoryPoolStatistics statistics() const
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            return statistics_;
+        }
+
+
+
+    private:
+        mutable std::mutex mutex_;
+        std::size_t maxBytesRetained_;
+        std::map<Key, std::vector<std::pair<Buffer, std::size_t>>> buffers_;
+        MemoryPoolStatistics statistics_;
+    };
+
+} // namespace core
+} // namespace PHARE
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef PHARE_CORE_UTILITIES_RANDOM_PHILOX_H
+#define PHARE_CORE_UTILITIES_RANDOM_PHILOX_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace PHARE
+{
+namespace core
+{
+    /** @brief Philox4x32 is the counter based random number generator Philox4x32-10 of Salmon
+     * et al. (SC'11). It has no state: four random 32 bits integers are a function of a 128 bits
+     * counter and a 64 bits key, so that any draw can be computed without the previous ones,
+     * e.g. concurrently, given a counter that identifies it.
+     */
+    class Philox4x32
+    {
+    public:
+        using counter_type = std::array<std::uint32_t, 4>;
+        using key_type     = std::array<std::uint32_t, 2>;
+
+        static constexpr counter_type generate(counter_type counter, key_type key)
+        {
+            for (auto round = 0; round < nbrRounds - 1; ++round)
+            {
+                counter = round_(counter, key);
+                key     = {{key[0] + weyl0, key[1] + weyl1}};
+            }
+            return round_(counter, key);
+        }
+
+
+    private:
+        static constexpr int nbrRounds              = 10;
+        static constexpr std::uint32_t multiplier0 = 0xD2511F53;
+        static constexpr std::uint32_t multiplier1 = 0xCD9E8D57;
+        static constexpr std::uint32_t weyl0       = 0x9E3779B9;
+        static constexpr std::uint32_t weyl1       = 0xBB67AE85;
+
+        static constexpr counter_type round_(counter_type const& counter, key_type const& key)
+        {
+            auto const product0 = std::uint64_t{multiplier0} * counter[0];
+            auto const product1 = std::uint64_t{multiplier1} * counter[2];
+
+            return {{static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                     static_cast<std::uint32_t>(product1),
+                     static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                     static_cast<std::uint32_t>(product0)}};
+        }
+    };
+
+
+
+
+    //! maps a random integer on [0, 1), with the 24 bits precision of a float
+    inline float uniformFloat(std::uint32_t random)
+    {
+        return static_cast<float>(random >> 8) * (1.f / 16777216.f);
+    }
+
+
+    //! maps a random integer on (0, 1]
+    inline double uniformOpenAtZero(std::uint32_t random)
+    {
+        return (static_cast<double>(random) + 1.) * (1. / 4294967296.);
+    }
+
+
+    //! two independent standard normal numbers from two random integers (Box-Muller)
+    inline std::pair<double, double> standardNormals(std::uint32_t random0, std::uint32_t random1)
+    {
+        constexpr double twoPi = 6.283185307179586476925286766559;
+
+        auto const radius = std::sqrt(-2. * std::log(uniformOpenAtZero(random0)));
+        auto const angle  = twoPi * (static_cast<double>(random1) * (1. / 4294967296.));
+
+        return {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+
+} // namespace core
+} // namespace PHARE
+
+#endif
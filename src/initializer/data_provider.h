@@ -4,9 +4,13 @@
 #include "cppdict/include/dict.hpp"
 //#include "models/physical_state.h"
 
+#include <array>
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <string>
 #include <variant>
+#include <vector>
 
 namespace PHARE
 {
@@ -26,7 +30,7 @@ namespace initializer
     template<>
     struct ScalarFunctionHelper<double, 2>
     {
-        using type = std::function<double(double)>;
+        using type = std::function<double(double, double)>;
     };
 
     template<>
@@ -66,9 +70,105 @@ namespace initializer
 
 
 
+    // ScalarArrayFunction and VectorArrayFunction are the batched versions of ScalarFunction and
+    // VectorFunction: they take the coordinates of many points, one array per direction, and
+    // return the values at all points, so that a whole patch is evaluated in one call, e.g. to a
+    // numpy vectorized user function. Vector values are returned component by component.
+
+    using CoordinateArray = std::vector<double>;
+    using ValueArray      = std::vector<double>;
+
+    template<std::size_t dim>
+    struct ArrayFunctionHelper
+    {
+    };
+
+    template<>
+    struct ArrayFunctionHelper<1>
+    {
+        using scalar = std::function<ValueArray(CoordinateArray const&)>;
+        using vector = std::function<std::array<ValueArray, 3>(CoordinateArray const&)>;
+    };
+
+    template<>
+    struct ArrayFunctionHelper<2>
+    {
+        using scalar = std::function<ValueArray(CoordinateArray const&, CoordinateArray const&)>;
+        using vector = std::function<std::array<ValueArray, 3>(CoordinateArray const&,
+                                                               CoordinateArray const&)>;
+    };
+
+    template<>
+    struct ArrayFunctionHelper<3>
+    {
+        using scalar = std::function<ValueArray(CoordinateArray const&, CoordinateArray const&,
+                                                CoordinateArray const&)>;
+        using vector = std::function<std::array<ValueArray, 3>(
+            CoordinateArray const&, CoordinateArray const&, CoordinateArray const&)>;
+    };
+
+    template<std::size_t dim>
+    using ScalarArrayFunction = typename ArrayFunctionHelper<dim>::scalar;
+
+    template<std::size_t dim>
+    using VectorArrayFunction = typename ArrayFunctionHelper<dim>::vector;
+
+
+
+
+    /** @brief vectorize makes a ScalarArrayFunction of a ScalarFunction, which it calls point by
+     * point. It lets code written for batched profiles take pointwise ones.
+     */
+    template<std::size_t dim>
+    ScalarArrayFunction<dim> vectorize(ScalarFunction<dim> function)
+    {
+        if (!function)
+        {
+            return nullptr;
+        }
+
+        return [function](CoordinateArray const& x, auto const&... otherCoords) {
+            ValueArray values(x.size());
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = function(x[i], otherCoords[i]...);
+            }
+            return values;
+        };
+    }
+
+
+    //! makes a VectorArrayFunction of a VectorFunction, see the scalar version
+    template<std::size_t dim>
+    VectorArrayFunction<dim> vectorize(VectorFunction<dim> function)
+    {
+        if (!function)
+        {
+            return nullptr;
+        }
+
+        return [function](CoordinateArray const& x, auto const&... otherCoords) {
+            std::array<ValueArray, 3> values{
+                {ValueArray(x.size()), ValueArray(x.size()), ValueArray(x.size())}};
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                auto value = function(x[i], otherCoords[i]...);
+                for (std::size_t iComp = 0; iComp < 3; ++iComp)
+                {
+                    values[iComp][i] = value[iComp];
+                }
+            }
+            return values;
+        };
+    }
+
+
+
+
     template<std::size_t dim>
-    using PHAREDict = cppdict::Dict<int, double, std::size_t, std::string, ScalarFunction<dim>,
-                                    VectorFunction<dim>>;
+    using PHAREDict
+        = cppdict::Dict<int, double, std::size_t, std::string, ScalarFunction<dim>,
+                        VectorFunction<dim>, ScalarArrayFunction<dim>, VectorArrayFunction<dim>>;
 
 
 
@@ -3,10 +3,24 @@
 #include "python_data_provider.h"
 
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
+#include <array>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
 
+
+namespace py = pybind11;
+
+using PHARE::initializer::CoordinateArray;
+using PHARE::initializer::ScalarArrayFunction;
 using PHARE::initializer::ScalarFunction;
+using PHARE::initializer::VectorArrayFunction;
+using PHARE::initializer::ValueArray;
 using PHARE::initializer::VectorFunction;
 
 
@@ -35,6 +49,106 @@ void add(std::string path, T&& value)
 
 
 
+py::array_t<double> toNumpy(std::vector<double> const& coords)
+{
+    return py::array_t<double>(coords.size(), coords.data());
+}
+
+
+// a vectorized profile returns an array of values, or a single value for all points
+std::vector<double> toValues(py::object const& result, std::size_t nbrPoints)
+{
+    auto array = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(result);
+    if (!array)
+    {
+        throw std::runtime_error("a vectorized profile must return numbers");
+    }
+
+    if (array.size() == 1)
+    {
+        return std::vector<double>(nbrPoints, *array.data());
+    }
+    return std::vector<double>(array.data(), array.data() + array.size());
+}
+
+
+
+
+/** addVectorizedScalar adds a user function to the dictionnary as a ScalarArrayFunction. It is
+ * called once per patch with numpy arrays of coordinates, e.g. f(x, y) in 2D, and returns the
+ * array of the values at these coordinates.
+ */
+template<std::size_t dim>
+void addVectorizedScalar(std::string path, py::function function)
+{
+    ScalarArrayFunction<dim> arrayFunction = [function](auto const& x, auto const&... others) {
+        return toValues(function(toNumpy(x), toNumpy(others)...), x.size());
+    };
+
+    cppdict::add(path, std::move(arrayFunction), PHARE::initializer::dict<dim>());
+}
+
+
+//! same as addVectorizedScalar, the function returns the three arrays of the components
+template<std::size_t dim>
+void addVectorizedVector(std::string path, py::function function)
+{
+    VectorArrayFunction<dim> arrayFunction = [function](auto const& x, auto const&... others) {
+        auto components = py::cast<py::sequence>(function(toNumpy(x), toNumpy(others)...));
+        if (components.size() != 3)
+        {
+            throw std::runtime_error("a vectorized vector profile must return 3 components");
+        }
+
+        return std::array<std::vector<double>, 3>{{toValues(components[0], x.size()),
+                                                   toValues(components[1], x.size()),
+                                                   toValues(components[2], x.size())}};
+    };
+
+    cppdict::add(path, std::move(arrayFunction), PHARE::initializer::dict<dim>());
+}
+
+
+
+
+// walks the '/' separated path down the dictionnary of the given dimension
+template<std::size_t dim>
+auto& node(std::string const& path)
+{
+    auto* current = &PHARE::initializer::dict<dim>();
+    std::istringstream keys{path};
+    for (std::string key; std::getline(keys, key, '/');)
+    {
+        current = &(*current)[key];
+    }
+    return *current;
+}
+
+
+/** evaluateVectorizedScalar calls the ScalarArrayFunction stored at path with one array of
+ * coordinates per direction, the way the simulation evaluates it on a patch. It lets a script
+ * check what the dictionnary of a given dimension actually holds.
+ */
+template<std::size_t dim>
+ValueArray evaluateVectorizedScalar(std::string path, std::array<CoordinateArray, dim> coords)
+{
+    auto& function = node<dim>(path).template to<ScalarArrayFunction<dim>>();
+    return std::apply(function, coords);
+}
+
+
+//! same as evaluateVectorizedScalar for a VectorArrayFunction
+template<std::size_t dim>
+std::array<ValueArray, 3> evaluateVectorizedVector(std::string path,
+                                                   std::array<CoordinateArray, dim> coords)
+{
+    auto& function = node<dim>(path).template to<VectorArrayFunction<dim>>();
+    return std::apply(function, coords);
+}
+
+
+
+
 PYBIND11_MODULE(pyphare, m)
 {
     m.def("add", add<1, int, void>, "add");
@@ -57,4 +171,22 @@ PYBIND11_MODULE(pyphare, m)
     m.def("add", add<1, VectorFunction<1>, void>, "add");
     m.def("add", add<2, VectorFunction<2>, void>, "add");
     m.def("add", add<3, VectorFunction<3>, void>, "add");
+
+    // the vectorized functions all take (str, function), so each dimension needs its own name
+    // for pybind11 to not always pick the first overload
+    m.def("addVectorizedScalar1D", addVectorizedScalar<1>, "addVectorizedScalar1D");
+    m.def("addVectorizedScalar2D", addVectorizedScalar<2>, "addVectorizedScalar2D");
+    m.def("addVectorizedScalar3D", addVectorizedScalar<3>, "addVectorizedScalar3D");
+
+    m.def("addVectorizedVector1D", addVectorizedVector<1>, "addVectorizedVector1D");
+    m.def("addVectorizedVector2D", addVectorizedVector<2>, "addVectorizedVector2D");
+    m.def("addVectorizedVector3D", addVectorizedVector<3>, "addVectorizedVector3D");
+
+    m.def("evaluateVectorizedScalar1D", evaluateVectorizedScalar<1>, "evaluateVectorizedScalar1D");
+    m.def("evaluateVectorizedScalar2D", evaluateVectorizedScalar<2>, "evaluateVectorizedScalar2D");
+    m.def("evaluateVectorizedScalar3D", evaluateVectorizedScalar<3>, "evaluateVectorizedScalar3D");
+
+    m.def("evaluateVectorizedVector1D", evaluateVectorizedVector<1>, "evaluateVectorizedVector1D");
+    m.def("evaluateVectorizedVector2D", evaluateVectorizedVector<2>, "evaluateVectorizedVector2D");
+    m.def("evaluateVectorizedVector3D", evaluateVectorizedVector<3>, "evaluateVectorizedVector3D");
 }
@@ -3,11 +3,16 @@
 
 #include <SAMRAI/hier/PatchData.h>
 #include <SAMRAI/tbox/MemoryUtilities.h>
+#include <SAMRAI/tbox/MessageStream.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
 #include <utility>
 
 #include "data/grid/gridlayout.h"
 #include "data/grid/gridlayout_impl.h"
 #include "tools/amr_utils.h"
+#include "utilities/memory/memory_pool.h"
 
 #include "field_geometry.h"
 
@@ -29,6 +34,26 @@ namespace amr_interface
     };
 
 
+    //! pool of field storages, keyed by the number of nodes of the field in each direction
+    template<typename FieldImpl>
+    using FieldStoragePool = core::MemoryPool<std::array<uint32, FieldImpl::dimension>,
+                                              typename FieldImpl::storage_type>;
+
+
+    /** @brief fieldStoragePool returns the pool shared by all FieldData of a given FieldImpl.
+     * Since the number of nodes derives from the ghost box and the centering of the quantity,
+     * buffers are recycled among quantities of the same centering, e.g. between regrids.
+     */
+    template<typename FieldImpl>
+    std::shared_ptr<FieldStoragePool<FieldImpl>> fieldStoragePool()
+    {
+        static auto pool = std::make_shared<FieldStoragePool<FieldImpl>>();
+        return pool;
+    }
+
+
+
+
     /**@brief FieldData is the specialization of SAMRAI::hier::PatchData to Field objects
      *
      */
@@ -51,13 +76,30 @@ namespace amr_interface
             : SAMRAI::hier::PatchData(domain, ghost)
             , gridLayout{std::move(layout)}
             , field(name, qty, gridLayout.allocSize(qty))
-            , quantity_{qty} {} //
+            , quantity_{qty}
+        {
+        }
 
-                  [[deprecated]] FieldData(
-                      SAMRAI::hier::Box const& domain, SAMRAI::hier::IntVector const& ghost,
-                      std::string name, std::array<double, dimension> const& dl,
-                      std::array<uint32, dimension> const& nbrCells,
-                      core::Point<double, dimension> const& origin, PhysicalQuantity qty)
+        /*** \brief Construct a FieldData whose field memory is taken from pool, if it retains a
+         * buffer of the right size, and given back to it on destruction
+         */
+        FieldData(SAMRAI::hier::Box const& domain, SAMRAI::hier::IntVector const& ghost,
+                  std::string name, GridLayoutT layout, PhysicalQuantity qty,
+                  std::shared_ptr<FieldStoragePool<FieldImpl>> pool)
+            : SAMRAI::hier::PatchData(domain, ghost)
+            , gridLayout{std::move(layout)}
+            , field(name, qty, gridLayout.allocSize(qty), pool->acquire(gridLayout.allocSize(qty)))
+            , quantity_{qty}
+            , pool_{std::move(pool)}
+        {
+        }
+
+        [[deprecated]] FieldData(SAMRAI::hier::Box const& domain,
+                                 SAMRAI::hier::IntVector const& ghost, std::string name,
+                                 std::array<double, dimension> const& dl,
+                                 std::array<uint32, dimension> const& nbrCells,
+                                 core::Point<double, dimension> const& origin,
+                                 PhysicalQuantity qty)
 
             : SAMRAI::hier::PatchData(domain, ghost)
             , gridLayout{dl, nbrCells, origin}
@@ -76,6 +118,17 @@ namespace amr_interface
         FieldData& operator=(FieldData const&) = delete;
 
 
+        ~FieldData()
+        {
+            if (pool_)
+            {
+                auto storage = field.releaseStorage();
+                auto bytes   = storage.capacity() * sizeof(typename FieldImpl::type);
+                pool_->release(gridLayout.allocSize(quantity_), std::move(storage), bytes);
+            }
+        }
+
+
 
         /*** \brief Copy information from another FieldData where data overlap
          *
@@ -220,11 +273,6 @@ namespace amr_interface
         void packStream(SAMRAI::tbox::MessageStream& stream,
                         const SAMRAI::hier::BoxOverlap& overlap) const final
         {
-            // getDataStreamSize_<true> mean that we want to apply the transformation
-            size_t expectedSize = getDataStreamSize_<true>(overlap) / sizeof(double);
-            std::vector<typename FieldImpl::type> buffer;
-            buffer.reserve(expectedSize);
-
             auto fieldOverlap = dynamic_cast<FieldOverlap<dimension> const*>(&overlap);
             TBOX_ASSERT(fieldOverlap != nullptr);
 
@@ -251,13 +299,11 @@ namespace amr_interface
                     packBox = packBox * sourceBox;
 
 
-                    internals_.packImpl(buffer, source, packBox, sourceBox);
+                    // the nodes are packed directly on the stream, row by row
+                    internals_.packImpl(stream, source, packBox, sourceBox);
                 }
             }
             // throw, we don't do rotations in phare....
-
-            // Once we have fill the buffer, we send it on the stream
-            stream.pack(buffer.data(), buffer.size());
         }
 
 
@@ -269,21 +315,11 @@ namespace amr_interface
         void unpackStream(SAMRAI::tbox::MessageStream& stream,
                           const SAMRAI::hier::BoxOverlap& overlap) final
         {
-            // For unpacking we need to know how much element we will need to
-            // extract
-            size_t expectedSize = getDataStreamSize(overlap) / sizeof(double);
-            // Here the seek counter will be used to index buffer
-            size_t seek = 0;
-            std::vector<double> buffer;
-            buffer.resize(expectedSize, 0.);
-
             auto fieldOverlap = dynamic_cast<FieldOverlap<dimension> const*>(&overlap);
             TBOX_ASSERT(fieldOverlap != nullptr);
 
-
-            // We flush a portion of the stream on the buffer.
-            stream.unpack(buffer.data(), expectedSize);
-
+            // The nodes are unpacked from the stream directly into the field, row by row, in
+            // the order packStream packed them
             SAMRAI::hier::Transformation const& transformation = fieldOverlap->getTransformation();
             if (transformation.getRotation() == SAMRAI::hier::Transformation::NO_ROTATE)
             {
@@ -303,7 +339,7 @@ namespace amr_interface
                     SAMRAI::hier::Box packBox{box * destination};
 
 
-                    internals_.unpackImpl(seek, buffer, source, packBox, destination);
+                    internals_.unpackImpl(stream, source, packBox, destination);
                 }
             }
         }
@@ -344,6 +380,7 @@ namespace amr_interface
 
     private:
         PhysicalQuantity quantity_; ///! PhysicalQuantity used for this field data
+        std::shared_ptr<FieldStoragePool<FieldImpl>> pool_; ///! where the field memory goes back
 
 
 
@@ -494,6 +531,28 @@ namespace amr_interface
 
 
 
+    /* The internals copy, pack and unpack whole rows of nodes along the last direction, which
+     * are contiguous in memory. Rows are copied with copyRow, and packed directly into (unpacked
+     * directly from) the MessageStream, in the same order as the nodes are visited by the for
+     * loops, i.e. x, then y, then z.
+     */
+
+
+
+    /**
+     * @brief copyRow copies the size nodes from source to destination. The source and
+     * destination rows belong to different fields, they must not overlap since std::copy_n does
+     * not allow the destination to start within the source.
+     */
+    template<typename T>
+    void copyRow(T const* source, int size, T* destination)
+    {
+        TBOX_ASSERT(std::less_equal<T const*>{}(source + size, destination)
+                    || std::less_equal<T const*>{}(destination + size, source));
+
+        std::copy_n(source, size, destination);
+    }
+
     // 1D internals implementation
     template<typename GridLayoutT, typename FieldImpl, typename PhysicalQuantity>
     class FieldDataInternals<GridLayoutT, 1, FieldImpl, PhysicalQuantity>
@@ -505,46 +564,43 @@ namespace amr_interface
             uint32 xSourceStart      = static_cast<uint32>(localSourceBox.lower(0));
             uint32 xDestinationStart = static_cast<uint32>(localDestinationBox.lower(0));
 
-            uint32 xSourceEnd      = static_cast<uint32>(localSourceBox.upper(0));
-            uint32 xDestinationEnd = static_cast<uint32>(localDestinationBox.upper(0));
+            int rowSize
+                = std::min(localSourceBox.numberCells(0), localDestinationBox.numberCells(0));
 
-            for (uint32 xSource = xSourceStart, xDestination = xDestinationStart;
-                 xSource <= xSourceEnd && xDestination <= xDestinationEnd;
-                 ++xSource, ++xDestination)
+            if (rowSize > 0)
             {
-                destination(xDestination) = source(xSource);
+                copyRow(&source(xSourceStart), rowSize, &destination(xDestinationStart));
             }
         }
 
 
 
 
-        void packImpl(std::vector<double>& buffer, FieldImpl const& source,
+        void packImpl(SAMRAI::tbox::MessageStream& stream, FieldImpl const& source,
                       SAMRAI::hier::Box const& overlap, SAMRAI::hier::Box const& destination) const
         {
             int xStart = overlap.lower(0) - destination.lower(0);
             int xEnd   = overlap.upper(0) - destination.lower(0);
 
-            for (int xi = xStart; xi <= xEnd; ++xi)
+            if (xEnd >= xStart)
             {
-                buffer.push_back(source(xi));
+                stream.pack(&source(xStart), static_cast<std::size_t>(xEnd - xStart + 1));
             }
         }
 
 
 
 
-        void unpackImpl(size_t& seek, std::vector<double> const& buffer, FieldImpl& source,
+        void unpackImpl(SAMRAI::tbox::MessageStream& stream, FieldImpl& source,
                         SAMRAI::hier::Box const& overlap,
                         SAMRAI::hier::Box const& destination) const
         {
             int xStart = overlap.lower(0) - destination.lower(0);
             int xEnd   = overlap.upper(0) - destination.lower(0);
 
-            for (int xi = xStart; xi <= xEnd; ++xi)
+            if (xEnd >= xStart)
             {
-                source(xi) = buffer[seek];
-                ++seek;
+                stream.unpack(&source(xStart), static_cast<std::size_t>(xEnd - xStart + 1));
             }
         }
     };
@@ -568,26 +624,27 @@ namespace amr_interface
             uint32 ySourceStart      = static_cast<uint32>(localSourceBox.lower(1));
             uint32 yDestinationStart = static_cast<uint32>(localDestinationBox.lower(1));
 
-            uint32 ySourceEnd      = static_cast<uint32>(localSourceBox.upper(1));
-            uint32 yDestinationEnd = static_cast<uint32>(localDestinationBox.upper(1));
+            int rowSize
+                = std::min(localSourceBox.numberCells(1), localDestinationBox.numberCells(1));
+
+            if (rowSize <= 0)
+            {
+                return;
+            }
 
             for (uint32 xSource = xSourceStart, xDestination = xDestinationStart;
                  xSource <= xSourceEnd && xDestination <= xDestinationEnd;
                  ++xSource, ++xDestination)
             {
-                for (uint32 ySource = ySourceStart, yDestination = yDestinationStart;
-                     ySource <= ySourceEnd && yDestination <= yDestinationEnd;
-                     ++ySource, ++yDestination)
-                {
-                    destination(xDestination, yDestination) = source(xSource, ySource);
-                }
+                copyRow(&source(xSource, ySourceStart), rowSize,
+                        &destination(xDestination, yDestinationStart));
             }
         }
 
 
 
 
-        void packImpl(std::vector<double>& buffer, FieldImpl const& source,
+        void packImpl(SAMRAI::tbox::MessageStream& stream, FieldImpl const& source,
                       SAMRAI::hier::Box const& overlap, SAMRAI::hier::Box const& destination) const
 
         {
@@ -597,19 +654,23 @@ namespace amr_interface
             int yStart = overlap.lower(1) - destination.lower(1);
             int yEnd   = overlap.upper(1) - destination.lower(1);
 
+            if (yEnd < yStart)
+            {
+                return;
+            }
+
+            auto rowSize = static_cast<std::size_t>(yEnd - yStart + 1);
+
             for (int xi = xStart; xi <= xEnd; ++xi)
             {
-                for (int yi = yStart; yi <= yEnd; ++yi)
-                {
-                    buffer.push_back(source(xi, yi));
-                }
+                stream.pack(&source(xi, yStart), rowSize);
             }
         }
 
 
 
 
-        void unpackImpl(size_t& seek, std::vector<double> const& buffer, FieldImpl& source,
+        void unpackImpl(SAMRAI::tbox::MessageStream& stream, FieldImpl& source,
                         SAMRAI::hier::Box const& overlap,
                         SAMRAI::hier::Box const& destination) const
         {
@@ -619,13 +680,16 @@ namespace amr_interface
             int yStart = overlap.lower(1) - destination.lower(1);
             int yEnd   = overlap.upper(1) - destination.lower(1);
 
+            if (yEnd < yStart)
+            {
+                return;
+            }
+
+            auto rowSize = static_cast<std::size_t>(yEnd - yStart + 1);
+
             for (int xi = xStart; xi <= xEnd; ++xi)
             {
-                for (int yi = yStart; yi <= yEnd; ++yi)
-                {
-                    source(xi, yi) = buffer[seek];
-                    ++seek;
-                }
+                stream.unpack(&source(xi, yStart), rowSize);
             }
         }
     };
@@ -655,8 +719,13 @@ namespace amr_interface
             uint32 zSourceStart      = static_cast<uint32>(localSourceBox.lower(2));
             uint32 zDestinationStart = static_cast<uint32>(localDestinationBox.lower(2));
 
-            uint32 zSourceEnd      = static_cast<uint32>(localSourceBox.upper(2));
-            uint32 zDestinationEnd = static_cast<uint32>(localDestinationBox.upper(2));
+            int rowSize
+                = std::min(localSourceBox.numberCells(2), localDestinationBox.numberCells(2));
+
+            if (rowSize <= 0)
+            {
+                return;
+            }
 
             for (uint32 xSource = xSourceStart, xDestination = xDestinationStart;
                  xSource <= xSourceEnd && xDestination <= xDestinationEnd;
@@ -666,13 +735,8 @@ namespace amr_interface
                      ySource <= ySourceEnd && yDestination <= yDestinationEnd;
                      ++ySource, ++yDestination)
                 {
-                    for (uint32 zSource = zSourceStart, zDestination = zDestinationStart;
-                         zSource <= zSourceEnd && zDestination <= zDestinationEnd;
-                         ++zSource, ++zDestination)
-                    {
-                        destination(xDestination, yDestination, zDestination)
-                            = source(xSource, ySource, zSource);
-                    }
+                    copyRow(&source(xSource, ySource, zSourceStart), rowSize,
+                            &destination(xDestination, yDestination, zDestinationStart));
                 }
             }
         }
@@ -680,7 +744,7 @@ namespace amr_interface
 
 
 
-        void packImpl(std::vector<double>& buffer, FieldImpl const& source,
+        void packImpl(SAMRAI::tbox::MessageStream& stream, FieldImpl const& source,
                       SAMRAI::hier::Box const& overlap, SAMRAI::hier::Box const& destination) const
         {
             int xStart = overlap.lower(0) - destination.lower(0);
@@ -692,14 +756,18 @@ namespace amr_interface
             int zStart = overlap.lower(2) - destination.lower(2);
             int zEnd   = overlap.upper(2) - destination.lower(2);
 
+            if (zEnd < zStart)
+            {
+                return;
+            }
+
+            auto rowSize = static_cast<std::size_t>(zEnd - zStart + 1);
+
             for (int xi = xStart; xi <= xEnd; ++xi)
             {
                 for (int yi = yStart; yi <= yEnd; ++yi)
                 {
-                    for (int zi = zStart; zi <= zEnd; ++zi)
-                    {
-                        buffer.push_back(source(xi, yi, zi));
-                    }
+                    stream.pack(&source(xi, yi, zStart), rowSize);
                 }
             }
         }
@@ -707,7 +775,7 @@ namespace amr_interface
 
 
 
-        void unpackImpl(size_t& seek, std::vector<double> const& buffer, FieldImpl& source,
+        void unpackImpl(SAMRAI::tbox::MessageStream& stream, FieldImpl& source,
                         SAMRAI::hier::Box const& overlap,
                         SAMRAI::hier::Box const& destination) const
         {
@@ -720,15 +788,18 @@ namespace amr_interface
             int zStart = overlap.lower(2) - destination.lower(2);
             int zEnd   = overlap.upper(2) - destination.lower(2);
 
+            if (zEnd < zStart)
+            {
+                return;
+            }
+
+            auto rowSize = static_cast<std::size_t>(zEnd - zStart + 1);
+
             for (int xi = xStart; xi <= xEnd; ++xi)
             {
                 for (int yi = yStart; yi <= yEnd; ++yi)
                 {
-                    for (int zi = zStart; zi <= zEnd; ++zi)
-                    {
-                        source(xi, yi, zi) = buffer[seek];
-                        ++seek;
-                    }
+                    stream.unpack(&source(xi, yi, zStart), rowSize);
                 }
             }
         }
@@ -36,6 +36,7 @@ namespace amr_interface
             , dataLivesOnPatchBorder_{dataLivesOnPatchBorder}
             , quantity_{qty}
             , name_{name}
+            , pool_{fieldStoragePool<FieldImpl>()}
         {
         }
 
@@ -71,12 +72,20 @@ namespace amr_interface
 
             return std::make_shared<FieldData<GridLayoutT, FieldImpl>>(
                 domain, SAMRAI::hier::IntVector{dim, 5}, name_, layoutFromPatch<GridLayoutT>(patch),
-                quantity_);
+                quantity_, pool_);
         }
 
 
 
 
+        /*** \brief pool the field memory of the allocated FieldData is recycled through, its
+         * statistics tell how many allocations regrids have saved
+         */
+        std::shared_ptr<FieldStoragePool<FieldImpl>> pool() const { return pool_; }
+
+
+
+
         std::shared_ptr<SAMRAI::hier::BoxGeometry>
         getBoxGeometry(SAMRAI::hier::Box const& box) const final
         {
@@ -175,6 +184,7 @@ namespace amr_interface
         bool const dataLivesOnPatchBorder_;
         PhysicalQuantity const quantity_;
         std::string name_;
+        std::shared_ptr<FieldStoragePool<FieldImpl>> pool_;
     };
 
 
@@ -1,8 +1,12 @@
 #ifndef PHARE_SRC_AMR_DATA_PARTICLES_PARTICLES_DATA_H
 #define PHARE_SRC_AMR_DATA_PARTICLES_PARTICLES_DATA_H
 
+#include <array>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <stdexcept>
+#include <vector>
 
 #include <SAMRAI/hier/BoxOverlap.h>
 #include <SAMRAI/hier/IntVector.h>
@@ -14,80 +18,70 @@
 #include "data/ions/ion_population/particle_pack.h"
 #include "data/particles/particle.h"
 #include "data/particles/particle_array.h"
+#include "data/particles/particle_wire_format.h"
 #include "tools/amr_utils.h"
+#include "utilities/memory/memory_pool.h"
 
 namespace PHARE
 {
 namespace amr_interface
 {
-    template<std::size_t dim>
-    static bool isInBox(SAMRAI::hier::Box const& box, core::Particle<dim> const& particle);
-
-    template<>
-    bool isInBox(SAMRAI::hier::Box const& box, core::Particle<1> const& particle)
-    {
-        auto const& iCell = particle.iCell;
-
-        auto const& lower = box.lower();
-        auto const& upper = box.upper();
-
-        if (iCell[0] >= lower(0) && iCell[0] <= upper(0))
-        {
-            return true;
-        }
-        return false;
-    }
-
-    template<>
-    inline bool isInBox(SAMRAI::hier::Box const& box, core::Particle<2> const& particle)
+    /** @brief isInBox returns true if the iCell of the given particle is within the given box
+     *
+     * The Particle type only needs a static dimension and an iCell subscriptable attribute,
+     * which makes this function usable with Particle and with particle proxies of SoA arrays.
+     */
+    template<typename Particle>
+    inline bool isInBox(SAMRAI::hier::Box const& box, Particle const& particle)
     {
         auto const& iCell = particle.iCell;
 
         auto const& lower = box.lower();
         auto const& upper = box.upper();
 
-
-        if (iCell[0] >= lower(0) && iCell[0] <= upper(0))
+        for (auto iDim = 0u; iDim < Particle::dimension; ++iDim)
         {
-            if (iCell[1] >= lower(1) && iCell[1] <= upper(1))
+            if (iCell[iDim] < lower(iDim) || iCell[iDim] > upper(iDim))
             {
-                return true;
+                return false;
             }
         }
-        return false;
+        return true;
     }
 
-    template<>
-    inline bool isInBox(SAMRAI::hier::Box const& box, core::Particle<3> const& particle)
-    {
-        auto const& iCell = particle.iCell;
 
-        auto const& lower = box.lower();
-        auto const& upper = box.upper();
 
+    //! the particle arrays of a ParticlesData, recycled together by a ParticlesPool
+    template<std::size_t dim>
+    using ParticleArrays = std::array<core::ParticleArray<dim>, 5>;
 
-        if (iCell[0] >= lower(0) && iCell[0] <= upper(0))
-        {
-            if (iCell[1] >= lower(1) && iCell[1] <= upper(1))
-            {
-                if (iCell[2] >= lower(2) && iCell[2] <= upper(2))
-                {
-                    return true;
-                }
-            }
-        }
-        return false;
+    //! pool of emptied particle arrays, keyed by the number of cells of the patch ghost box
+    template<std::size_t dim>
+    using ParticlesPool = core::MemoryPool<std::size_t, ParticleArrays<dim>>;
+
+
+    /** @brief particlesPool returns the pool shared by all ParticlesData of a given dimension.
+     * The arrays it retains are empty but keep their capacity, so that the patches of a new
+     * level do not have to grow their arrays again when filled.
+     */
+    template<std::size_t dim>
+    std::shared_ptr<ParticlesPool<dim>> particlesPool()
+    {
+        static auto pool = std::make_shared<ParticlesPool<dim>>();
+        return pool;
     }
 
 
-    /*template<>
-    bool isInBox(SAMRAI::hier::Box const& box, Particle<1> const& particle);
 
-    template<>
-    bool isInBox(SAMRAI::hier::Box const& box, Particle<1> const& particle);
+    //! counters of the particle selections made by a ParticlesData for ghost exchanges
+    struct ParticleStreamCounters
+    {
+        std::size_t scanned    = 0; //!< particles tested against a selection box
+        std::size_t sent       = 0; //!< particles packed on a stream
+        std::size_t selections = 0; //!< selections made by scanning the particles
+        std::size_t cacheHits  = 0; //!< selections made by getDataStreamSize reused by packStream
+    };
 
-    template<>
-    bool isInBox(SAMRAI::hier::Box const& box, Particle<1> const& particle);*/
 
 
     /** @brief ParticlesData is a concrete SAMRAI::hier::PatchData subclass to store Particle data
@@ -130,12 +124,57 @@ namespace amr_interface
 
 
 
+        /**
+         * @brief builds a ParticlesData whose particle arrays are taken from pool, if it retains
+         * arrays for a ghost box of this size, and given back to it, emptied, on destruction
+         */
+        ParticlesData(SAMRAI::hier::Box const& box, SAMRAI::hier::IntVector const& ghost,
+                      std::shared_ptr<ParticlesPool<dim>> pool)
+            : ParticlesData(box, ghost)
+        {
+            pool_ = std::move(pool);
+
+            auto arrays            = pool_->acquire(poolKey_());
+            domainParticles        = std::move(arrays[0]);
+            patchGhostParticles    = std::move(arrays[1]);
+            levelGhostParticles    = std::move(arrays[2]);
+            levelGhostParticlesOld = std::move(arrays[3]);
+            levelGhostParticlesNew = std::move(arrays[4]);
+
+            particlesChanged();
+        }
+
+
+
         ParticlesData()                     = delete;
         ParticlesData(ParticlesData const&) = delete;
         ParticlesData(ParticlesData&&)      = default;
 
 
 
+        ~ParticlesData()
+        {
+            if (pool_)
+            {
+                ParticleArrays<dim> arrays{{std::move(domainParticles),
+                                            std::move(patchGhostParticles),
+                                            std::move(levelGhostParticles),
+                                            std::move(levelGhostParticlesOld),
+                                            std::move(levelGhostParticlesNew)}};
+
+                std::size_t bytes = 0;
+                for (auto& array : arrays)
+                {
+                    core::empty(array);
+                    bytes += core::allocatedBytes(array);
+                }
+
+                pool_->release(poolKey_(), std::move(arrays), bytes);
+            }
+        }
+
+
+
         ParticlesData& operator=(ParticlesData const&) = delete;
 
 
@@ -167,10 +206,7 @@ namespace amr_interface
                 SAMRAI::hier::Box const& myGhostBox     = getGhostBox();
                 const SAMRAI::hier::Box intersectionBox{sourceGhostBox * myGhostBox};
 
-                if (!intersectionBox.empty())
-                {
-                    copy_(sourceGhostBox, myGhostBox, intersectionBox, *pSource);
-                }
+                copy_(intersectionBox, SAMRAI::hier::IntVector::getZero(getDim()), *pSource);
             }
             else
             {
@@ -220,32 +256,11 @@ namespace amr_interface
 
                         if (isSameBlock(transformation))
                         {
-                            if (offsetIsZero(transformation))
-                            {
-                                intersectionBox = overlapBox * sourceGhostBox * destinationGhostBox;
-
-                                if (!intersectionBox.empty())
-                                {
-                                    copy_(sourceGhostBox, destinationGhostBox, intersectionBox,
-                                          *pSource);
-                                }
-                            }
-                            else
-                            {
-                                SAMRAI::hier::Box shiftedSourceBox{sourceGhostBox};
-                                transformation.transform(shiftedSourceBox);
-                                intersectionBox
-                                    = overlapBox * shiftedSourceBox * destinationGhostBox;
-
-                                if (!intersectionBox.empty())
-                                {
-                                    /* copy_(sourceGhostBox, destinationGhostBox, intersectionBox,
-                                     *pSource);*/
-
-                                    copyWithTransform_(sourceGhostBox, intersectionBox,
-                                                       transformation, *pSource);
-                                }
-                            }
+                            SAMRAI::hier::Box shiftedSourceBox{sourceGhostBox};
+                            transformation.transform(shiftedSourceBox);
+                            intersectionBox = overlapBox * shiftedSourceBox * destinationGhostBox;
+
+                            copy_(intersectionBox, transformation.getOffset(), *pSource);
                         }
                         else
                         {
@@ -277,20 +292,50 @@ namespace amr_interface
 
 
 
+        /**
+         * @brief the stream size depends on the number of particles in the overlap, it thus
+         * cannot be estimated from the box only, but getDataStreamSize() gives it exactly.
+         */
         virtual bool canEstimateStreamSizeFromBox() const final { return false; }
 
 
 
 
+        /**
+         * @brief getDataStreamSize returns the exact number of bytes packStream() puts on the
+         * stream for the given overlap: for each box of the overlap, the number of particles
+         * followed by the particles in the compact core::ParticleWireFormat.
+         *
+         * The particles selected for each box are kept for packStream(), which SAMRAI calls
+         * next with the same overlap, so that the particles are only scanned once. SAMRAI sizes
+         * all the overlaps sent to a rank before it packs them, so the selections are kept by box
+         * until packStream() uses them.
+         */
         virtual size_t getDataStreamSize(SAMRAI::hier::BoxOverlap const& overlap) const final
         {
             SAMRAI::pdat::CellOverlap const* pOverlap{
                 dynamic_cast<SAMRAI::pdat::CellOverlap const*>(&overlap)};
 
-            std::size_t numberParticles = countNumberParticlesIn_(*pOverlap);
+            TBOX_ASSERT(pOverlap != nullptr);
 
-            return SAMRAI::tbox::MemoryUtilities::align(numberParticles
-                                                        * sizeof(core::ParticleArray<dim>));
+            std::size_t size = 0;
+
+            if (!pOverlap->isOverlapEmpty())
+            {
+                SAMRAI::hier::Transformation const& transformation = pOverlap->getTransformation();
+                SAMRAI::hier::Box transformedSource{getGhostBox()};
+                transformation.transform(transformedSource);
+
+                for (auto const& destinationBox : pOverlap->getDestinationBoxContainer())
+                {
+                    auto const& selection = cachedSelection_(transformedSource * destinationBox,
+                                                             transformation.getOffset());
+
+                    size += sizeof(std::size_t) + WireFormat::bufferSize(selection.size());
+                }
+            }
+
+            return SAMRAI::tbox::MemoryUtilities::align(size);
         }
 
 
@@ -333,6 +378,12 @@ namespace amr_interface
          * at this point with iCell=1 we know the particle should be placed into the interior
          * particle buffer
          *
+         * Particles are packed box by box: for each destination box of the overlap, the number
+         * of particles is followed by the particles in the compact core::ParticleWireFormat,
+         * their iCell being relative to the lower cell of the destination box.
+         *
+         * The selections made by getDataStreamSize() for this overlap are used, and dropped,
+         * if the particles have not changed since.
          */
         virtual void packStream(SAMRAI::tbox::MessageStream& stream,
                                 SAMRAI::hier::BoxOverlap const& overlap) const final
@@ -342,40 +393,43 @@ namespace amr_interface
 
             TBOX_ASSERT(pOverlap != nullptr);
 
-            std::vector<core::Particle<dim>> specie;
-
             if (pOverlap->isOverlapEmpty())
             {
-                constexpr std::size_t zero = 0;
-                stream << zero;
+                return;
             }
-            else
-            {
-                SAMRAI::hier::Transformation const& transformation = pOverlap->getTransformation();
-                if (transformation.getRotation() == SAMRAI::hier::Transformation::NO_ROTATE)
-                {
-                    SAMRAI::hier::BoxContainer const& boxContainer
-                        = pOverlap->getDestinationBoxContainer();
 
-                    auto const& sourceBox = getGhostBox();
-
-                    SAMRAI::hier::Box transformedSource{sourceBox};
-                    transformation.transform(transformedSource);
+            SAMRAI::hier::Transformation const& transformation = pOverlap->getTransformation();
+            if (transformation.getRotation() != SAMRAI::hier::Transformation::NO_ROTATE)
+            {
+                throw std::runtime_error("Error - rotations not handled in PHARE");
+            }
 
+            SAMRAI::hier::Box transformedSource{getGhostBox()};
+            transformation.transform(transformedSource);
 
-                    for (auto const& destinationBox : boxContainer)
-                    {
-                        SAMRAI::hier::Box intersectionBox{transformedSource * destinationBox};
+            std::vector<char> buffer;
 
-                        pack_(specie, intersectionBox, sourceBox, transformation);
-                    }
-                }
-                else
+            for (auto const& destinationBox : pOverlap->getDestinationBoxContainer())
+            {
+                auto origin = toPHAREBox<dim>(destinationBox).lower.template toArray<int>();
+
+                auto const sourceBox = sourceBox_(transformedSource * destinationBox,
+                                                  transformation.getOffset());
+
+                buffer.clear();
+                forEachSelected_(cachedSelection_(sourceBox), transformation.getOffset(),
+                                 [&](auto const& particle) {
+                                     WireFormat::append(particle, origin, buffer);
+                                 });
+                selections_.erase(selectionKey_(sourceBox));
+
+                std::size_t numberParticles = buffer.size() / WireFormat::particleSize;
+                counters_.sent += numberParticles;
+                stream << numberParticles;
+                if (numberParticles > 0)
                 {
-                    throw std::runtime_error("Error - rotations not handled in PHARE");
+                    stream.pack(buffer.data(), buffer.size());
                 }
-                stream << specie.size();
-                stream.pack(specie.data(), specie.size());
             }
         }
 
@@ -390,9 +444,7 @@ namespace amr_interface
          * transformation from source to destination AMR indexes.
          *
          * By convention chosen in patckStream, packed particles have their iCell in our AMR index
-         * space. This means that before putting them into our local arrays, we need to apply
-         * AMRToLocal() to get the proper shift to apply to them
-         *
+         * space, relative to the lower cell of the destination box they are packed for.
          */
         virtual void unpackStream(SAMRAI::tbox::MessageStream& stream,
                                   SAMRAI::hier::BoxOverlap const& overlap) final
@@ -401,85 +453,97 @@ namespace amr_interface
                 = dynamic_cast<SAMRAI::pdat::CellOverlap const*>(&overlap);
             TBOX_ASSERT(pOverlap != nullptr);
 
-            std::vector<core::Particle<dim>> particleArray;
+            if (pOverlap->isOverlapEmpty())
+            {
+                return;
+            }
 
-            if (!pOverlap->isOverlapEmpty())
+            SAMRAI::hier::Transformation const& transformation = pOverlap->getTransformation();
+            if (transformation.getRotation() != SAMRAI::hier::Transformation::NO_ROTATE)
             {
-                // unpack particles into a particle array
-                size_t numberParticles = 0;
-                stream >> numberParticles;
-                particleArray.resize(numberParticles);
-                stream.unpack(particleArray.data(), numberParticles);
+                throw std::runtime_error("Error - rotations not handled in PHARE");
+            }
 
-                // ok now our goal is to put the particles we have just unpacked
-                // into the particleData and in the proper particleArray : interior or ghost
+            auto myBox      = getBox();
+            auto myGhostBox = getGhostBox();
 
-                SAMRAI::hier::Transformation const& transformation = pOverlap->getTransformation();
-                if (transformation.getRotation() == SAMRAI::hier::Transformation::NO_ROTATE)
+            std::vector<char> buffer;
+            core::Particle<dim> particle;
+
+            for (auto const& destinationBox : pOverlap->getDestinationBoxContainer())
+            {
+                std::size_t numberParticles = 0;
+                stream >> numberParticles;
+
+                buffer.resize(WireFormat::bufferSize(numberParticles));
+                if (numberParticles > 0)
                 {
-                    // we loop over all boxes in the overlap
-                    // we have to first take the intersection of each of these boxes
-                    // with our ghostBox. This is where unpacked particles should go.
+                    stream.unpack(buffer.data(), buffer.size());
+                }
 
-                    SAMRAI::hier::BoxContainer const& destinationBoxes
-                        = pOverlap->getDestinationBoxContainer();
+                // unpacked particles go in our domain or ghost particles, depending on where
+                // they are in the intersection of the destination box and our ghost box
+                auto const intersect = myGhostBox * destinationBox;
+                auto origin = toPHAREBox<dim>(destinationBox).lower.template toArray<int>();
 
-                    auto myBox      = getBox();
-                    auto myGhostBox = getGhostBox();
+                char const* in = buffer.data();
+                for (auto iPart = 0u; iPart < numberParticles; ++iPart)
+                {
+                    in = WireFormat::read(in, origin, particle);
 
-                    for (auto const& box : destinationBoxes)
+                    if (isInBox(intersect, particle))
                     {
-                        // our goal here is :
-                        // 1/ to check if the each particle is in the intersect of the overlap boxes
-                        // and our ghostBox 2/ if yes, check if these particles should go within the
-                        // interior array or ghost array
-
-                        // first we need to calculate the intersect between our ghostBox and the
-                        // overlapBox these and the resulting intersect are in AMR index space
-                        // unpacked particles have their iCell in our AMR index space. we could :
-                        //  1- compare their iCell with the intersect right away, if within shit
-                        //  them to local indexing and push them in proper array
-                        // or
-                        // 2- translate the intersect from  AMR to local indexing, shift the
-                        // particles from AMR to local, and do the comparison in local index space
-                        // and then push them in the proper array
-
-                        auto const intersect = getGhostBox() * box;
-
-
-                        // we chose first option, so get the intersect in local index space
-                        // and get the vector to shift a particle from our AMR space to local index
-                        // space
-                        // auto intersectLocalSource = AMRToLocal(intersect, getGhostBox());
-                        // auto particleShift        = AMRToLocal(getGhostBox());
-
-                        for (auto const& particle : particleArray)
+                        if (isInBox(myBox, particle))
+                        {
+                            domainParticles.push_back(particle);
+                        }
+                        else
                         {
-                            // shift the particle to local index space
-                            // and if it is in intersection, decide in which array to push it.
-                            // auto shiftedParticle{particle};
-                            // shiftParticle_(particleShift, shiftedParticle);
-
-                            if (isInBox(intersect, particle))
-                            {
-                                if (isInBox(myBox, particle))
-                                {
-                                    domainParticles.push_back(std::move(particle));
-                                }
-                                else
-                                {
-                                    patchGhostParticles.push_back(std::move(particle));
-                                }
-                            }
-                        } // end species loop
-                    }     // end box loop
-                }         // end no rotation
-            }             // end overlap not empty
+                            patchGhostParticles.push_back(particle);
+                        }
+                    }
+                }
+            }
+
+            particlesChanged();
+        }
+
+
+
+        /**
+         * @brief getPointer gives the core write access to the particles, e.g. to push them.
+         * The border index and the kept selections are thus dropped, since the particles may be
+         * moved in place. Particles modified through a pointer obtained before a ghost exchange
+         * must be followed by a call to particlesChanged().
+         */
+        core::ParticlesPack<core::ParticleArray<dim>>* getPointer()
+        {
+            particlesChanged();
+            return &pack;
+        }
+
+
+
+        /**
+         * @brief particlesChanged drops the border index and the selections kept for
+         * packStream(). It is called by every ParticlesData entry point that modifies the domain
+         * or patch ghost particles (copy, unpackStream, getPointer), and must be called by code
+         * that modifies them through the public arrays, as the particle split does. Adding or
+         * removing particles is also detected without it, as a fallback.
+         */
+        void particlesChanged()
+        {
+            borderIndex_.built = false;
+            selections_.clear();
+            cachedState_ = state_();
         }
 
 
 
-        core::ParticlesPack<core::ParticleArray<dim>>* getPointer() { return &pack; }
+        //! counters of the particles scanned and sent by ghost exchanges since the last reset
+        ParticleStreamCounters const& streamCounters() const { return counters_; }
+
+        void resetStreamCounters() { counters_ = ParticleStreamCounters{}; }
 
 
 
@@ -499,186 +563,291 @@ namespace amr_interface
 
 
     private:
+        using WireFormat = core::ParticleWireFormat<dim>;
+
         //! interiorLocalBox_ is the box, in local index space, that goes from the first to the last
         //! cell in our patch physical domain, i.e. "from dual physical start index to dual physical
         //! end index"
         SAMRAI::hier::Box interiorLocalBox_;
 
+        //! where the particle arrays go back on destruction, if any
+        std::shared_ptr<ParticlesPool<dim>> pool_;
 
 
+        std::size_t poolKey_() const { return static_cast<std::size_t>(getGhostBox().size()); }
 
-        void copy_(SAMRAI::hier::Box const& sourceGhostBox,
-                   SAMRAI::hier::Box const& destinationGhostBox,
-                   SAMRAI::hier::Box const& intersectionBox, ParticlesData const& sourceData)
-        {
-            std::array<decltype(sourceData.domainParticles) const*, 2> particlesArrays{
-                &sourceData.domainParticles, &sourceData.patchGhostParticles};
 
-            auto myDomainBox = this->getBox();
 
 
-            // for each particles in the source ghost and domain particle arrays
-            // we check if it is in the intersectionBox
-            // if it is, is it in my domain box ?
-            //      - if so, let's add it to my domain particle array
-            //      - if not, let's add it to my ghost particle array
-            for (auto const& sourceParticlesArray : particlesArrays)
-            {
-                for (auto const& particle : *sourceParticlesArray)
+        /**
+         * @brief copy_ copies the particles of sourceData which iCell, shifted by offset, is in
+         * intersectionBox into our domain or patch ghost particles, depending on where they are.
+         */
+        void copy_(SAMRAI::hier::Box const& intersectionBox, SAMRAI::hier::IntVector const& offset,
+                   ParticlesData const& sourceData)
+        {
+            auto myDomainBox = this->getBox();
+
+            sourceData.selectParticles_(intersectionBox, offset, [&](auto const& particle) {
+                if (isInBox(myDomainBox, particle))
                 {
-                    if (isInBox(intersectionBox, particle))
-                    {
-                        if (isInBox(myDomainBox, particle))
-                        {
-                            domainParticles.push_back(particle);
-                        }
-                        else
-                        {
-                            patchGhostParticles.push_back(particle);
-                        }
-                    }
+                    domainParticles.push_back(particle);
                 }
-            }
+                else
+                {
+                    patchGhostParticles.push_back(particle);
+                }
+            });
+
+            particlesChanged();
         }
 
 
 
 
-        void copyWithTransform_(SAMRAI::hier::Box const& sourceGhostBox,
-                                SAMRAI::hier::Box const& intersectionBox,
-                                SAMRAI::hier::Transformation const& transformation,
-                                ParticlesData const& sourceData)
+        //! indexes, in domainParticles and patchGhostParticles, of selected particles
+        struct Selection
         {
-            std::array<decltype(sourceData.domainParticles) const*, 2> particlesArrays{
-                &sourceData.domainParticles, &sourceData.patchGhostParticles};
+            std::vector<std::size_t> domain;
+            std::vector<std::size_t> patchGhost;
 
-            auto myDomainBox = this->getBox();
+            std::size_t size() const { return domain.size() + patchGhost.size(); }
+        };
 
-            auto offset = transformation.getOffset();
+        using SelectionKey = std::array<int, 2 * dim>;
 
-            for (auto const& sourceParticlesArray : particlesArrays)
-            {
-                for (auto const& particle : *sourceParticlesArray)
-                {
-                    // the particle is only copied if it is in the intersectionBox
-                    // but before its iCell must be shifted by the transformation offset
 
-                    auto newParticle{particle};
-                    for (auto iDir = 0; iDir < newParticle.iCell.size(); ++iDir)
-                    {
-                        newParticle.iCell[iDir] += offset[iDir];
-                    }
 
-                    if (isInBox(intersectionBox, newParticle))
-                    {
-                        // now we now the particle is in the intersection
-                        // we need to know whether it is in the domain part of that
-                        // intersection. If it is not, then it must be in the ghost part
+
+        /**
+         * @brief selectParticles_ calls fn on each of our domain and patch ghost particles
+         * which iCell, shifted by offset, is in the given box. fn receives the shifted particle.
+         */
+        template<typename Fn>
+        void selectParticles_(SAMRAI::hier::Box const& intersectionBox,
+                              SAMRAI::hier::IntVector const& offset, Fn&& fn) const
+        {
+            Selection selection;
+            select_(sourceBox_(intersectionBox, offset), selection);
+            forEachSelected_(selection, offset, std::forward<Fn>(fn));
+        }
 
 
-                        if (isInBox(myDomainBox, newParticle))
-                        {
-                            domainParticles.push_back(newParticle);
-                        }
-                        else
-                        {
-                            patchGhostParticles.push_back(newParticle);
-                        }
-                    }
+
+
+        //! calls fn on the particles of selection, which iCell is shifted by offset
+        template<typename Fn>
+        void forEachSelected_(Selection const& selection, SAMRAI::hier::IntVector const& offset,
+                              Fn&& fn) const
+        {
+            auto shifted = [&offset](auto const& particle) {
+                core::Particle<dim> shiftedParticle = particle;
+                for (auto i = 0u; i < dim; ++i)
+                {
+                    shiftedParticle.iCell[i] += offset[i];
                 }
+                return shiftedParticle;
+            };
+
+            for (auto iPart : selection.domain)
+            {
+                fn(shifted(domainParticles[iPart]));
+            }
+            for (auto iPart : selection.patchGhost)
+            {
+                fn(shifted(patchGhostParticles[iPart]));
             }
+        }
 
 
-            // SAMRAI::hier::Box localSourceSelectionBox = AMRToLocal(intersectionBox,
-            // sourceGhostBox);
 
-            // we shift it back the box on top of source AMR indexes
-            // transformation.inverseTransform(localSourceSelectionBox);
 
-            // copy_(sourceData, particleShift, localSourceSelectionBox);
+        //! the box intersectionBox, which is on the destination cells, shifted back on ours
+        static SAMRAI::hier::Box sourceBox_(SAMRAI::hier::Box const& intersectionBox,
+                                            SAMRAI::hier::IntVector const& offset)
+        {
+            SAMRAI::hier::Box sourceBox{intersectionBox};
+            sourceBox.shift(-offset);
+            return sourceBox;
+        }
+
+
+
+        static SelectionKey selectionKey_(SAMRAI::hier::Box const& sourceBox)
+        {
+            SelectionKey key;
+            for (auto i = 0u; i < dim; ++i)
+            {
+                key[i]       = sourceBox.lower()(i);
+                key[dim + i] = sourceBox.upper()(i);
+            }
+            return key;
         }
 
 
 
 
         /**
-         * @brief countNumberParticlesIn_ counts the number of interior particles that lie
-         * within the boxes of an overlap
+         * @brief select_ puts in selection the indexes of our domain and patch ghost particles
+         * which iCell is in sourceBox.
+         *
+         * A ghost exchange only selects particles near the boundary of the patch. When the box
+         * does not reach the core of the patch, i.e. the domain minus a ghost width wide border,
+         * the domain particles are taken from the border index instead of being all tested.
          */
-        std::size_t countNumberParticlesIn_(SAMRAI::pdat::CellOverlap const& overlap) const
+        void select_(SAMRAI::hier::Box const& sourceBox, Selection& selection) const
         {
-            std::size_t numberParticles = 0;
-
-            if (overlap.isOverlapEmpty())
+            if (sourceBox.empty())
             {
-                return numberParticles;
+                return;
             }
 
-            auto const& boxes = overlap.getDestinationBoxContainer();
+            ++counters_.selections;
 
-            for (auto const& box : boxes)
+            if (sourceBox.intersects(coreBox_()))
+            {
+                for (std::size_t iPart = 0; iPart < domainParticles.size(); ++iPart)
+                {
+                    if (isInBox(sourceBox, domainParticles[iPart]))
+                    {
+                        selection.domain.push_back(iPart);
+                    }
+                }
+                counters_.scanned += domainParticles.size();
+            }
+            else
             {
-                SAMRAI::hier::Box shiftedBox{box};
-                SAMRAI::hier::Transformation const& transformation = overlap.getTransformation();
-                transformation.transform(shiftedBox);
-                SAMRAI::hier::Box intersectionBox{shiftedBox * getBox()};
+                auto const& border = borderParticles_();
+                for (auto iPart : border)
+                {
+                    if (isInBox(sourceBox, domainParticles[iPart]))
+                    {
+                        selection.domain.push_back(iPart);
+                    }
+                }
+                counters_.scanned += border.size();
+            }
 
-                numberParticles += countNumberParticlesIn_(intersectionBox);
+            for (std::size_t iPart = 0; iPart < patchGhostParticles.size(); ++iPart)
+            {
+                if (isInBox(sourceBox, patchGhostParticles[iPart]))
+                {
+                    selection.patchGhost.push_back(iPart);
+                }
             }
-            return numberParticles;
+            counters_.scanned += patchGhostParticles.size();
         }
 
 
-        /**
-         * @brief countNumberParticlesIn_ returns the number of interior particles within a given
-         * box
-         *
-         * the box given is in AMR index space so the function first needs to put it in
-         * local indexing relative to the domain box
-         */
-        std::size_t countNumberParticlesIn_(SAMRAI::hier::Box const& box) const
+
+
+        //! the selection of the particles in the box intersectionBox shifted back by offset,
+        //! made if it is not kept yet
+        Selection const& cachedSelection_(SAMRAI::hier::Box const& intersectionBox,
+                                          SAMRAI::hier::IntVector const& offset) const
         {
-            std::size_t numberParticles{0};
+            return cachedSelection_(sourceBox_(intersectionBox, offset));
+        }
 
-            auto localSourceBox = AMRToLocal(box, getBox());
 
-            for (auto const& particle : domainParticles)
+        Selection const& cachedSelection_(SAMRAI::hier::Box const& sourceBox) const
+        {
+            refresh_();
+
+            auto [selection, isNew] = selections_.try_emplace(selectionKey_(sourceBox));
+            if (isNew)
             {
-                if (isInBox(localSourceBox, particle))
-                {
-                    ++numberParticles;
-                }
+                select_(sourceBox, selection->second);
+            }
+            else
+            {
+                ++counters_.cacheHits;
             }
-            return numberParticles;
+            return selection->second;
         }
 
 
 
 
-        void pack_(std::vector<core::Particle<dim>>& buffer,
-                   SAMRAI::hier::Box const& intersectionBox, SAMRAI::hier::Box const& sourceBox,
-                   SAMRAI::hier::Transformation const& transformation) const
+        //! the domain minus the border cells, which are within a ghost width of its boundary
+        SAMRAI::hier::Box coreBox_() const
         {
-            std::array<decltype(domainParticles) const*, 2> particlesArrays{&domainParticles,
-                                                                            &patchGhostParticles};
+            SAMRAI::hier::Box core{getBox()};
+            core.grow(-getGhostCellWidth());
+            return core;
+        }
+
+
+
+        //! what changes when particles are added or removed
+        std::array<std::size_t, 4> state_() const
+        {
+            return {{domainParticles.size(), domainParticles.capacity(),
+                     patchGhostParticles.size(), patchGhostParticles.capacity()}};
+        }
+
+
+
+        //! drops the border index and the kept selections if particles were added or removed
+        //! without particlesChanged() being called
+        void refresh_() const
+        {
+            auto state = state_();
+            if (state != cachedState_)
+            {
+                borderIndex_.built = false;
+                selections_.clear();
+                cachedState_ = state;
+            }
+        }
+
+
 
-            for (auto const& sourceParticlesArray : particlesArrays)
+        //! indexes of the domain particles in the border cells, built when first needed after
+        //! the particles changed
+        std::vector<std::size_t> const& borderParticles_() const
+        {
+            refresh_();
+
+            if (!borderIndex_.built)
             {
-                for (auto const& particle : *sourceParticlesArray)
+                auto core = coreBox_();
+
+                borderIndex_.particles.clear();
+                for (std::size_t iPart = 0; iPart < domainParticles.size(); ++iPart)
                 {
-                    auto shiftedParticle{particle};
-                    auto offset = transformation.getOffset();
-                    for (auto i = 0; i < dim; ++i)
-                    {
-                        shiftedParticle.iCell[i] += offset[i];
-                    }
-                    if (isInBox(intersectionBox, shiftedParticle))
+                    if (!isInBox(core, domainParticles[iPart]))
                     {
-                        buffer.push_back(shiftedParticle);
+                        borderIndex_.particles.push_back(iPart);
                     }
                 }
+                counters_.scanned += domainParticles.size();
+
+                borderIndex_.built = true;
             }
+
+            return borderIndex_.particles;
         }
+
+
+
+        struct BorderIndex
+        {
+            bool built = false;
+            std::vector<std::size_t> particles;
+        };
+
+        //! state_() of the particles the border index and the kept selections were made for
+        mutable std::array<std::size_t, 4> cachedState_{{0, 0, 0, 0}};
+
+        //! domain particles ghost exchanges select from, see select_
+        mutable BorderIndex borderIndex_;
+
+        //! selections made by getDataStreamSize() for packStream(), keyed by their box, each
+        //! dropped once packed
+        mutable std::map<SelectionKey, Selection> selections_;
+
+        mutable ParticleStreamCounters counters_;
     };
 } // namespace amr_interface
 
@@ -30,6 +30,7 @@ namespace amr_interface
         ParticlesDataFactory(SAMRAI::hier::IntVector ghost, bool fineBoundaryRepresentsVariable)
             : SAMRAI::hier::PatchDataFactory{ghost}
             , fineBoundaryRepresentsVariable_{fineBoundaryRepresentsVariable}
+            , pool_{particlesPool<dim>()}
         {
         }
 
@@ -43,7 +44,7 @@ namespace amr_interface
         virtual std::shared_ptr<SAMRAI::hier::PatchData>
         allocate(const SAMRAI::hier::Patch& patch) const final
         {
-            return std::make_shared<ParticlesData<dim>>(patch.getBox(), d_ghosts);
+            return std::make_shared<ParticlesData<dim>>(patch.getBox(), d_ghosts, pool_);
         }
 
         virtual std::shared_ptr<SAMRAI::hier::BoxGeometry>
@@ -73,8 +74,14 @@ namespace amr_interface
         }
 
         // End SAMRAI interface
+
+
+        //! pool the particle arrays of the allocated ParticlesData are recycled through
+        std::shared_ptr<ParticlesPool<dim>> pool() const { return pool_; }
+
     private:
         bool fineBoundaryRepresentsVariable_;
+        std::shared_ptr<ParticlesPool<dim>> pool_;
 
 
     private:
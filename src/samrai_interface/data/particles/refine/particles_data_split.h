@@ -11,7 +11,9 @@
 #include <SAMRAI/hier/RefineOperator.h>
 #include <SAMRAI/pdat/CellOverlap.h>
 
+#include <array>
 #include <functional>
+#include <memory>
 
 namespace PHARE
 {
@@ -146,14 +148,10 @@ namespace amr_interface
             auto const& srcGhostParticles    = srcParticlesData.patchGhostParticles;
 
             // the particle refine operator's job is to fill either domain (during initialization of
-            // new patches) or coarse to fine boundaries (during advance), so we need references to
-            // these arrays on the destination. We don't fill ghosts with this operator, they are
-            // filled from exchanging with neighbor patches.
-            auto const& destBoxes                = destFieldOverlap.getDestinationBoxContainer();
-            auto& destCoarseBoundaryParticles    = destParticlesData.levelGhostParticles;
-            auto& destDomainParticles            = destParticlesData.domainParticles;
-            auto& destCoarseBoundaryOldParticles = destParticlesData.levelGhostParticlesOld;
-            auto& destCoarseBoundaryNewParticles = destParticlesData.levelGhostParticlesNew;
+            // new patches) or coarse to fine boundaries (during advance), destinationParticles_
+            // gives the array to fill on the destination. We don't fill ghosts with this operator,
+            // they are filled from exchanging with neighbor patches.
+            auto const& destBoxes = destFieldOverlap.getDestinationBoxContainer();
 
 
             // We get the source box that contains ghost region in order to get local index later
@@ -163,20 +161,16 @@ namespace amr_interface
             auto const& destGhostBox   = destParticlesData.getGhostBox();
             auto const& destDomainBox  = destParticlesData.getBox();
 
-            /*auto computeRatio = [&ratio]() {
-                Point<int32, dim> pointRatio;
+            auto const& split = splitFor_(ratio);
 
-                for (auto iDir = dirX; iDir < dim; ++iDir)
-                {
-                    pointRatio[iDir] = ratio[iDir];
-                }
-                return pointRatio;
-            };*/
+            // babies of one coarse particle are written in this fixed size array, and then
+            // copied in the destination array if they are in the destination box
+            std::array<core::Particle<dim>, refinedParticleNbr> refinedParticles;
 
-            // TODO refineParticleNbr should not be runtime and SplitT should be created only once.
-            // SplitT split{computeRatio(), refinedParticleNbr};
+            auto& destParticles = destinationParticles_(destParticlesData);
 
-            SplitT split{core::Point<int32, dim>{ratio}, refinedParticleNbr};
+            std::array<std::remove_reference_t<decltype(srcInteriorParticles)>*, 2>
+                particlesArrays{{&srcInteriorParticles, &srcGhostParticles}};
 
 
             // The PatchLevelFillPattern had compute boxes that correspond to the expected filling.
@@ -184,83 +178,118 @@ namespace amr_interface
             // in case of interior, this will be just one boxe usually
             for (auto const& destinationBox : destBoxes)
             {
-                std::array<std::remove_reference_t<decltype(srcInteriorParticles)>*, 2>
-                    particlesArrays{{&srcInteriorParticles, &srcGhostParticles}};
-
-
-                auto isInDest = [&destinationBox](auto const& particle) //
-                { return isInBox(destinationBox, particle); };
-
+                auto const splitBox = getSplitBox(destinationBox);
 
+                // a first pass counts the coarse particles to split, so that the destination
+                // array is only grown once per box
+                std::size_t nbrCandidates = 0;
                 for (auto const& sourceParticlesArray : particlesArrays)
                 {
                     for (auto const& particle : *sourceParticlesArray)
                     {
-                        std::vector<core::Particle<dim>> refinedParticles;
-                        auto particleRefinedPos{particle};
-
-                        for (int iDim = 0; iDim < dim; ++iDim)
+                        if (isInBox(splitBox, refinedPosition_(particle, ratio)))
                         {
-                            particleRefinedPos.iCell[iDim]
-                                = particle.iCell[iDim] * ratio[iDim]
-                                  + static_cast<int>(particle.delta[iDim] * ratio[iDim]);
-                            particleRefinedPos.delta[iDim]
-                                = particle.delta[iDim] * ratio[iDim]
-                                  - static_cast<int>(particle.delta[iDim] * ratio[iDim]);
+                            ++nbrCandidates;
                         }
+                    }
+                }
+                destParticles.reserve(destParticles.size() + nbrCandidates * refinedParticleNbr);
 
 
-                        if (isCandidateForSplit_(particleRefinedPos, destinationBox))
+                for (auto const& sourceParticlesArray : particlesArrays)
+                {
+                    for (auto const& particle : *sourceParticlesArray)
+                    {
+                        auto particleRefinedPos = refinedPosition_(particle, ratio);
+
+                        if (isInBox(splitBox, particleRefinedPos))
                         {
                             split(particleRefinedPos, refinedParticles);
 
-
-                            // we need to know in which of interior or levelGhostParticlesXXXX
-                            // arrays we must put particles
-
-                            bool constexpr putParticlesInCoarseBoundary
-                                = splitType == ParticlesDataSplitType::coarseBoundary
-                                  || splitType == ParticlesDataSplitType::coarseBoundaryOld
-                                  || splitType == ParticlesDataSplitType::coarseBoundaryNew;
-
-
-
-                            if (putParticlesInCoarseBoundary)
+                            for (auto const& refinedParticle : refinedParticles)
                             {
-                                if constexpr (splitType == ParticlesDataSplitType::coarseBoundary)
+                                if (isInBox(destinationBox, refinedParticle))
                                 {
-                                    std::copy_if(
-                                        std::begin(refinedParticles), std::end(refinedParticles),
-                                        std::back_inserter(destCoarseBoundaryParticles), isInDest);
-                                }
-                                else if constexpr (splitType
-                                                   == ParticlesDataSplitType::coarseBoundaryOld)
-                                {
-                                    //
-                                    std::copy_if(std::begin(refinedParticles),
-                                                 std::end(refinedParticles),
-                                                 std::back_inserter(destCoarseBoundaryOldParticles),
-                                                 isInDest);
-                                }
-                                else //  splitType is coarseBoundaryNew
-                                {
-                                    std::copy_if(std::begin(refinedParticles),
-                                                 std::end(refinedParticles),
-                                                 std::back_inserter(destCoarseBoundaryNewParticles),
-                                                 isInDest);
+                                    destParticles.push_back(refinedParticle);
                                 }
                             }
-
-                            else
-                            {
-                                std::copy_if(std::begin(refinedParticles),
-                                             std::end(refinedParticles),
-                                             std::back_inserter(destDomainParticles), isInDest);
-                            }
                         } // end is candidate for split
                     }     // end loop on particles
                 }         // end loop on source particle arrays
             }             // loop on destination box
+
+            if constexpr (splitType == ParticlesDataSplitType::interior)
+            {
+                destParticlesData.particlesChanged();
+            }
+        }
+
+
+
+
+        /** @brief the split only depends on the refinement ratio, it is thus built once and
+         * rebuilt only if the operator is used with another ratio.
+         */
+        SplitT const& splitFor_(SAMRAI::hier::IntVector const& ratio) const
+        {
+            core::Point<int32, dim> splitRatio{ratio};
+
+            if (!split_ || !(splitRatio_ == splitRatio))
+            {
+                split_      = std::make_unique<SplitT>(splitRatio, refinedParticleNbr);
+                splitRatio_ = splitRatio;
+            }
+            return *split_;
+        }
+
+
+
+
+        /** @brief the particle array of the destination the babies go in, depending on the
+         * split type: levelGhostParticles(Old/New) for coarse boundaries, domainParticles
+         * for the interior
+         */
+        static auto& destinationParticles_(ParticlesData<dim>& destParticlesData)
+        {
+            if constexpr (splitType == ParticlesDataSplitType::coarseBoundary)
+            {
+                return destParticlesData.levelGhostParticles;
+            }
+            else if constexpr (splitType == ParticlesDataSplitType::coarseBoundaryOld)
+            {
+                return destParticlesData.levelGhostParticlesOld;
+            }
+            else if constexpr (splitType == ParticlesDataSplitType::coarseBoundaryNew)
+            {
+                return destParticlesData.levelGhostParticlesNew;
+            }
+            else
+            {
+                return destParticlesData.domainParticles;
+            }
+        }
+
+
+
+
+        /** @brief the coarse particle with its iCell and delta expressed on the refined grid
+         */
+        template<typename Particle>
+        static core::Particle<dim> refinedPosition_(Particle const& particle,
+                                                    SAMRAI::hier::IntVector const& ratio)
+        {
+            core::Particle<dim> particleRefinedPos{particle};
+
+            for (auto iDim = 0u; iDim < dim; ++iDim)
+            {
+                particleRefinedPos.iCell[iDim]
+                    = particle.iCell[iDim] * ratio[iDim]
+                      + static_cast<int>(particle.delta[iDim] * ratio[iDim]);
+                particleRefinedPos.delta[iDim]
+                    = particle.delta[iDim] * ratio[iDim]
+                      - static_cast<int>(particle.delta[iDim] * ratio[iDim]);
+            }
+            return particleRefinedPos;
         }
 
 
@@ -288,15 +317,8 @@ namespace amr_interface
         }
 
 
-
-
-        template<typename Particle>
-        bool isCandidateForSplit_(Particle const& particle,
-                                  SAMRAI::hier::Box const& toFillBox) const
-        {
-            auto toSplitBox = getSplitBox(toFillBox);
-            return isInBox(toSplitBox, particle);
-        }
+        mutable std::unique_ptr<SplitT> split_;
+        mutable core::Point<int32, dim> splitRatio_;
     };
 } // namespace amr_interface
 
@@ -2,9 +2,11 @@
 #define PHARE_SPLIT_H
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include "data/grid/gridlayout.h"
@@ -163,30 +165,64 @@ namespace amr_interface
             for (uint32 refinedParticleIndex = 0; refinedParticleIndex < refinedParticlesNbr_;
                  ++refinedParticleIndex)
             {
-                if constexpr (dimension == 1)
-                {
-                    // the values for icell & delta are only working for 1 dim...
-                    float weight = coarsePartOnRefinedGrid.weight * weights_[refinedParticleIndex];
-                    int32 icell  = coarsePartOnRefinedGrid.iCell[0];
-                    float delta  = coarsePartOnRefinedGrid.delta[0]
-                                  + deltasX_[refinedParticleIndex] * refinementFactor_[dirX];
-
-                    // weights & deltas are the only known values for the babies.
-                    // so the icell values of each baby needs to be calculated
-                    float integra = std::floor(delta);
-                    delta -= integra;
-                    icell += static_cast<int32>(integra);
-
-                    refinedParticles.push_back({weight,
-                                                coarsePartOnRefinedGrid.charge,
-                                                {{icell}},
-                                                {{delta}},
-                                                coarsePartOnRefinedGrid.v});
-                }
-                else // unsupported dimension
-                {
-                    static_assert("Only 1D is supported for split at the moment");
-                }
+                refinedParticles.push_back(baby_(coarsePartOnRefinedGrid, refinedParticleIndex));
+            }
+        }
+
+
+
+
+        /** @brief writes the babies of the coarse particle in a fixed size array, which
+         * avoids any allocation when splitting many particles. The array must have as many
+         * particles as the refined particle number given at construction.
+         */
+        template<std::size_t refinedParticlesNbr>
+        inline void operator()(
+            core::Particle<dimension> const& coarsePartOnRefinedGrid,
+            std::array<core::Particle<dimension>, refinedParticlesNbr>& refinedParticles) const
+        {
+            if (refinedParticlesNbr != refinedParticlesNbr_)
+            {
+                throw std::runtime_error("Error - wrong number of refined particles");
+            }
+
+            for (uint32 refinedParticleIndex = 0; refinedParticleIndex < refinedParticlesNbr;
+                 ++refinedParticleIndex)
+            {
+                refinedParticles[refinedParticleIndex]
+                    = baby_(coarsePartOnRefinedGrid, refinedParticleIndex);
+            }
+        }
+
+
+
+
+    private:
+        inline core::Particle<dimension>
+        baby_(core::Particle<dimension> const& coarsePartOnRefinedGrid,
+              uint32 refinedParticleIndex) const
+        {
+            if constexpr (dimension == 1)
+            {
+                // the values for icell & delta are only working for 1 dim...
+                float weight = coarsePartOnRefinedGrid.weight * weights_[refinedParticleIndex];
+                int32 icell  = coarsePartOnRefinedGrid.iCell[0];
+                float delta  = coarsePartOnRefinedGrid.delta[0]
+                              + deltasX_[refinedParticleIndex] * refinementFactor_[dirX];
+
+                // weights & deltas are the only known values for the babies.
+                // so the icell values of each baby needs to be calculated
+                float integra = std::floor(delta);
+                delta -= integra;
+                icell += static_cast<int32>(integra);
+
+                return {weight, coarsePartOnRefinedGrid.charge, {{icell}}, {{delta}},
+                        coarsePartOnRefinedGrid.v};
+            }
+            else // unsupported dimension
+            {
+                static_assert("Only 1D is supported for split at the moment");
+                return coarsePartOnRefinedGrid;
             }
         }
     };
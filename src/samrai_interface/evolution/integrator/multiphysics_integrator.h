@@ -2,8 +2,11 @@
 #ifndef PHARE_MULTIPHYSICS_INTEGRATOR_H
 #define PHARE_MULTIPHYSICS_INTEGRATOR_H
 
+#include <array>
+#include <cmath>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -11,6 +14,7 @@
 
 #include <SAMRAI/algs/TimeRefinementLevelStrategy.h>
 #include <SAMRAI/mesh/StandardTagAndInitStrategy.h>
+#include <SAMRAI/tbox/SAMRAI_MPI.h>
 
 #include "evolution/solvers/solver.h"
 #include "evolution/solvers/solver_mhd.h"
@@ -25,6 +29,8 @@
 #include "evolution/messengers/messenger_initializer.h"
 #include "evolution/messengers/mhd_messenger.h"
 
+#include "numerics/time_step/time_step_controller.h"
+#include "tagging/tagger.h"
 #include "utilities/algorithm.h"
 
 #include "tools/resources_manager.h"
@@ -41,6 +47,7 @@ namespace amr_interface
         int modelIndex            = NOT_SET;
         int solverIndex           = NOT_SET;
         int resourcesManagerIndex = NOT_SET;
+        int taggerIndex           = NOT_SET;
         std::string messengerName;
         // std::unique_ptr<IMessenger> fromCoarser;
     };
@@ -76,6 +83,14 @@ namespace amr_interface
      * - registerAndSetupMessengers() : used to register the messengers associated with the
      * registered IPhysicalModel and ISolver objects
      *
+     * Levels on which an ITagger is registered with registerTagger() are tagged for refinement by
+     * it, other levels are never refined dynamically.
+     *
+     * The time step of each level is chosen by a core::TimeStepController from the rates the
+     * solver of the level reports, reduced over all MPI ranks, and never exceeds maxDt, the
+     * time step configured for the simulation. When nothing constrains it, for instance when the
+     * solver reports no rate, the time step is maxDt.
+     *
      */
     template<typename MessengerFactory>
     class MultiPhysicsIntegrator : public SAMRAI::mesh::StandardTagAndInitStrategy,
@@ -85,11 +100,19 @@ namespace amr_interface
         static constexpr auto dimension = MessengerFactory::dimension;
 
         // model comes with its variables already registered to the manager system
-        MultiPhysicsIntegrator(int nbrOfLevels)
+        MultiPhysicsIntegrator(int nbrOfLevels, double maxDt,
+                               core::TimeStepController timeStepController = {})
             : nbrOfLevels_{nbrOfLevels}
             , levelDescriptors_(nbrOfLevels)
+            , maxDt_{maxDt}
+            , timeStepControllers_(nbrOfLevels, timeStepController)
 
         {
+            if (!(maxDt_ > 0.) || !std::isfinite(maxDt_))
+            {
+                throw std::runtime_error("Error - maxDt must be positive and finite");
+            }
+
             // auto mhdSolver = std::make_unique<SolverMHD<ResourcesManager>>(resourcesManager_);
             // solvers.push_back(std::move(mhdSolver));
 
@@ -217,6 +240,38 @@ namespace amr_interface
 
 
 
+        /**
+         * @brief registerTagger registers the tagger used to tag the cells to refine on levels
+         * between coarsestLevel and finestLevel (included). The tagger must be compatible with
+         * the model registered on these levels.
+         */
+        void registerTagger(int coarsestLevel, int finestLevel, std::unique_ptr<ITagger> tagger)
+        {
+            if (!validLevelRange_(coarsestLevel, finestLevel))
+            {
+                throw std::runtime_error("invalid level range");
+            }
+
+            for (auto iLevel = coarsestLevel; iLevel <= finestLevel; ++iLevel)
+            {
+                if (getModel_(iLevel).name() != tagger->modelName())
+                {
+                    throw std::runtime_error(
+                        "tagger is not compatible with model on specified level range");
+                }
+            }
+
+            taggers_.push_back(std::move(tagger));
+
+            for (auto iLevel = coarsestLevel; iLevel <= finestLevel; ++iLevel)
+            {
+                levelDescriptors_[iLevel].taggerIndex = taggers_.size() - 1;
+            }
+        }
+
+
+
+
         std::string solverName(int iLevel) const { return getSolver_(iLevel).name(); }
 
 
@@ -343,11 +398,23 @@ namespace amr_interface
 
 
 
+        /**
+         * @brief see SAMRAI documentation. The cells of the level are tagged by the ITagger
+         * registered for it, if any.
+         */
         void applyGradientDetector(const std::shared_ptr<SAMRAI::hier::PatchHierarchy>& hierarchy,
                                    const int levelNumber, const double error_data_time,
                                    const int tag_index, const bool initialTime,
                                    const bool usesRichardsonExtrapolationToo) override
         {
+            auto taggerIndex = levelDescriptors_[levelNumber].taggerIndex;
+            if (taggerIndex == LevelDescriptor::NOT_SET)
+            {
+                return;
+            }
+
+            auto level = hierarchy->getPatchLevel(levelNumber);
+            taggers_[taggerIndex]->tag(getModel_(levelNumber), *level, tag_index);
         }
 
 
@@ -364,17 +431,37 @@ namespace amr_interface
         {
         }
 
+        /**
+         * @brief getLevelDt returns the time step of the given level.
+         *
+         * The solver of the level gives the rates the time step must resolve on the patches of
+         * this MPI rank, these are reduced over all ranks so that all of them use the same time
+         * step, and the TimeStepController of the level turns them into a time step.
+         */
         virtual double getLevelDt(const std::shared_ptr<SAMRAI::hier::PatchLevel>& level,
-                                  const double dtTime, const bool initialTime) override
+                                  const double, const bool initialTime) override
         {
-            return dtTime;
+            auto iLevel = level->getLevelNumber();
+            auto rates  = getSolver_(iLevel).timeStepRates(getModel_(iLevel), *level);
+
+            std::array<double, 3> ratesBuffer{{rates.particles, rates.whistler, rates.gyration}};
+            SAMRAI::tbox::SAMRAI_MPI::getSAMRAIWorld().AllReduce(
+                ratesBuffer.data(), static_cast<int>(ratesBuffer.size()), MPI_MAX);
+
+            auto& timeStepController = timeStepControllers_[iLevel];
+            if (initialTime)
+            {
+                timeStepController.reset();
+            }
+
+            return timeStepController.dt({ratesBuffer[0], ratesBuffer[1], ratesBuffer[2]}, maxDt_);
         }
 
 
         virtual double getMaxFinerLevelDt(const int finerLevelNumber, const double coarseDt,
                                           const SAMRAI::hier::IntVector& ratio) override
         {
-            return std::pow(coarseDt, ratio.max());
+            return coarseDt / ratio.max();
         }
 
 
@@ -477,6 +564,9 @@ namespace amr_interface
         std::vector<std::unique_ptr<ISolver>> solvers_;
         std::vector<std::shared_ptr<IPhysicalModel>> models_;
         std::map<std::string, std::unique_ptr<IMessenger>> messengers_;
+        std::vector<std::unique_ptr<ITagger>> taggers_;
+        double maxDt_;
+        std::vector<core::TimeStepController> timeStepControllers_;
 
 
         bool validLevelRange_(int coarsestLevel, int finestLevel)
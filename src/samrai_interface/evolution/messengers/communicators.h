@@ -5,9 +5,12 @@
 
 #include <SAMRAI/hier/RefineOperator.h>
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 
 
@@ -28,6 +31,15 @@ namespace amr_interface
      * @brief The Communicators class is used by a Messenger to manipulate SAMRAI algorithms and
      * schedules It contains a QuantityCommunicator for all quantities registered to the Messenger
      * for ghost, init etc.
+     *
+     * All quantities are also registered on a single algorithm, so that filling or regridding all
+     * of them on a level executes one schedule: patches then exchange one message per neighbor
+     * for all quantities, instead of one message per quantity. For the same reason, quantities
+     * that are filled together may be grouped with addGroup().
+     *
+     * GhostField quantities are filled by key, or by group, at every step. Only the schedules of
+     * the groups are created when a level is registered, the others are created the first time
+     * they are used on the level.
      */
     template<CommunicatorType Type>
     class Communicators
@@ -46,7 +58,11 @@ namespace amr_interface
                  std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp, std::string key,
                  std::shared_ptr<ResourcesManager> const& rm)
         {
-            add_(makeCommunicator(descriptor, rm, refineOp), key);
+            add_(
+                [descriptor, refineOp, rm](SAMRAI::xfer::RefineAlgorithm& algo) {
+                    registerRefines(algo, descriptor, rm, refineOp);
+                },
+                key);
         }
 
 
@@ -66,92 +82,92 @@ namespace amr_interface
                  std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp,
                  std::shared_ptr<SAMRAI::hier::TimeInterpolateOperator> timeOp, std::string key)
         {
-            add_(makeCommunicator(ghostDescriptor, modelDescriptor, oldModelDescriptor, rm,
-                                  refineOp, timeOp),
-                 key);
+            add_(
+                [ghostDescriptor, modelDescriptor, oldModelDescriptor, rm, refineOp,
+                 timeOp](SAMRAI::xfer::RefineAlgorithm& algo) {
+                    registerRefines(algo, ghostDescriptor, modelDescriptor, oldModelDescriptor, rm,
+                                    refineOp, timeOp);
+                },
+                key);
         }
 
 
 
 
         /**
-         * @brief registerLevel registers a level of the hierarchy to all QuantityCommunicators in
-         * the Communicators.
-         *
-         * For each QuantityCommunicator, the method takes the RefineAlgorithm and creates a
-         * schedule by calling one of the createSchedule() overloads. The specific overload that is
-         * called depends on the (compile-time) nature of the Communicators.
-         *
+         * @brief addGroup adds a QuantityCommunicator for all the quantities previously added
+         * with the given keys, associated with groupKey. fillGroup() then fills these quantities
+         * with a single schedule.
          */
-        void registerLevel(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
-                           std::shared_ptr<SAMRAI::hier::PatchLevel>& level)
+        void addGroup(std::string const& groupKey, std::vector<std::string> const& keys)
         {
-            for (auto& [_, communicator] : communicators_)
-            {
-                auto& algo       = communicator.algo;
-                auto levelNumber = level->getLevelNumber();
+            static_assert(Type == CommunicatorType::GhostField,
+                          "only ghost communicators are filled by key");
 
+            if (communicators_.find(groupKey) != std::end(communicators_))
+            {
+                throw std::runtime_error(groupKey + " is already registered");
+            }
 
-                // for GhostField we need schedules that take on the level where there is an overlap
-                // (there is always for patches lying inside the level)
-                // and goes to coarser level where there is not (patch lying on the level border)
-                if constexpr (Type == CommunicatorType::GhostField)
+            QuantityCommunicator group;
+            for (auto const& key : keys)
+            {
+                if (auto registration = registrations_.find(key);
+                    registration != std::end(registrations_))
                 {
-                    auto schedule = algo->createSchedule(
-                        level, level->getNextCoarserHierarchyLevelNumber(), hierarchy);
-                    communicator.add(schedule, levelNumber);
+                    registration->second(*group.algo);
                 }
-
-                // this createSchedule overload is used to initialize fields.
-                // note that here we must take that createsSchedule() overload and put nullptr as
-                // src since we want to take from coarser level everywhere. using the createSchedule
-                // overload that takes level, next_coarser_level only would result in interior ghost
-                // nodes to be filled with interior of neighbor patches but there is nothing there.
-                else if constexpr (Type == CommunicatorType::InitField)
+                else
                 {
-                    communicator.add(
-                        algo->createSchedule(level, nullptr, levelNumber - 1, hierarchy),
-                        levelNumber);
+                    throw std::runtime_error(key + " is not registered, cannot group it");
                 }
+            }
 
+            communicators_[groupKey] = std::move(group);
+            groupKeys_.push_back(groupKey);
+        }
 
-                // here we create the schedule that will intialize the particles that lie within the
-                // interior of the patches (no ghost, no coarse to fine). We take almost the same
-                // overload as for fields above but the version that takes a PatchLevelFillPattern.
-                // Here the PatchLevelInteriorFillPattern is used because we want to fill particles
-                // only within the interior of the patches of the level. The reason is that filling
-                // the their ghost regions with refined particles would not ensure the ghosts to be
-                // clones of neighbor patches particles if the splitting from coarser levels is not
-                // deterministic.
-                else if constexpr (Type == CommunicatorType::InitInteriorPart)
-                {
-                    communicator.add(
-                        algo->createSchedule(
-                            std::make_shared<SAMRAI::xfer::PatchLevelInteriorFillPattern>(), level,
-                            nullptr, levelNumber - 1, hierarchy),
-                        levelNumber);
-                }
 
-                // here we create a schedule that will refine particles from coarser level and put
-                // them into the level coarse to fine boundary. These are the levelGhostParticlesOld
-                // particles. we thus take the same createSchedule overload as above but pass it a
-                // PatchLevelBorderFillPattern.
-                else if constexpr (Type == CommunicatorType::LevelBorderParticles)
+
+
+        /**
+         * @brief registerLevel registers a level of the hierarchy to the Communicators.
+         *
+         * The method creates a schedule for the level from the algorithm on which all quantities
+         * are registered, by calling one of the createSchedule() overloads. The specific overload
+         * that is called depends on the (compile-time) nature of the Communicators. For
+         * GhostField, only the groups get their schedule here: the schedules made for a previous
+         * level with the same number are dropped, and the others are made on first use.
+         *
+         */
+        void registerLevel(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
+                           std::shared_ptr<SAMRAI::hier::PatchLevel>& level)
+        {
+            if (registrations_.empty())
+            {
+                return;
+            }
+
+            if constexpr (Type == CommunicatorType::GhostField)
+            {
+                auto levelNumber     = level->getLevelNumber();
+                levels_[levelNumber] = {hierarchy, level};
+
+                all_.remove(levelNumber);
+                for (auto& [_, communicator] : communicators_)
                 {
-                    communicator.add(
-                        algo->createSchedule(
-                            std::make_shared<SAMRAI::xfer::PatchLevelBorderFillPattern>(), level,
-                            nullptr, levelNumber - 1, hierarchy),
-                        levelNumber);
+                    communicator.remove(levelNumber);
                 }
 
-                // this branch is used to create a schedule that will transfer particles into the
-                // patches' ghost zones.
-                else if constexpr (Type == CommunicatorType::InteriorGhostParticles)
+                for (auto const& groupKey : groupKeys_)
                 {
-                    communicator.add(algo->createSchedule(level), levelNumber);
+                    addSchedule_(communicators_[groupKey], hierarchy, level);
                 }
             }
+            else
+            {
+                addSchedule_(all_, hierarchy, level);
+            }
         }
 
 
@@ -161,30 +177,27 @@ namespace amr_interface
          * @brief initialize is used to initialize data on the level for all quantities in the
          * Communicators.
          *
-         * Basically the method just takes all QuantityCommunicator one by one, find the schedule
-         * associated with the given level number and executes fillData().
+         * Basically the method finds the schedule of all quantities associated with the given
+         * level number and executes fillData().
          *
          * The method registerLevel must have been called before for the given levelNumber otherwise
          * no schedule will be found
          */
-        void fill(int levelNumber, double initDataTime) const
+        void fill(int levelNumber, double initDataTime)
         {
-            for (auto& [key, communicator] : communicators_)
+            if (registrations_.empty())
             {
-                if (communicator.algo == nullptr)
-                {
-                    throw std::runtime_error("Algorithm is nullptr");
-                }
+                return;
+            }
 
-                auto schedule = communicator.findSchedule(levelNumber);
-                if (schedule)
-                {
-                    (*schedule)->fillData(initDataTime);
-                }
-                else
-                {
-                    throw std::runtime_error("Error - schedule cannot be found for this level");
-                }
+            auto schedule = findSchedule_(all_, levelNumber);
+            if (schedule)
+            {
+                (*schedule)->fillData(initDataTime);
+            }
+            else
+            {
+                throw std::runtime_error("Error - schedule cannot be found for this level");
             }
         }
 
@@ -199,20 +212,17 @@ namespace amr_interface
                             std::shared_ptr<SAMRAI::hier::PatchLevel> const& oldLevel,
                             double const initDataTime)
         {
-            for (auto& [key, refiner] : communicators_)
+            if (registrations_.empty())
             {
-                auto& algo = refiner.algo;
+                return;
+            }
 
-                // here 'nullptr' is for 'oldlevel' which is always nullptr in this function
-                // the regriding schedule for which oldptr is not nullptr is handled in another
-                // function
-                auto const& level = hierarchy->getPatchLevel(levelNumber);
+            auto const& level = hierarchy->getPatchLevel(levelNumber);
 
-                auto schedule = algo->createSchedule(
-                    level, oldLevel, level->getNextCoarserHierarchyLevelNumber(), hierarchy);
+            auto schedule = all_.algo->createSchedule(
+                level, oldLevel, level->getNextCoarserHierarchyLevelNumber(), hierarchy);
 
-                schedule->fillData(initDataTime);
-            }
+            schedule->fillData(initDataTime);
         }
 
 
@@ -228,26 +238,124 @@ namespace amr_interface
         template<typename VecFieldT>
         void fill(VecFieldT& vec, int const levelNumber, double const fillTime)
         {
-            auto schedule = findSchedule_(vec.name(), levelNumber);
+            fillGroup(vec.name(), levelNumber, fillTime);
+        }
+
+
+
+
+        /**
+         * @brief fillGroup fills the quantities associated with the given key, typically the
+         * group of quantities added with addGroup(), with a single schedule.
+         */
+        void fillGroup(std::string const& key, int const levelNumber, double const fillTime)
+        {
+            auto schedule = findSchedule_(key, levelNumber);
             if (schedule)
             {
                 (*schedule)->fillData(fillTime);
             }
             else
             {
-                throw std::runtime_error("no schedule for " + vec.name());
+                throw std::runtime_error("no schedule for " + key);
             }
         }
 
 
 
     private:
-        void add_(QuantityCommunicator&& communicator, std::string const& key)
+        using Registration = std::function<void(SAMRAI::xfer::RefineAlgorithm&)>;
+
+
+        void add_(Registration registration, std::string const& key)
         {
-            if (communicators_.find(key) == std::end(communicators_))
-                communicators_[key] = std::move(communicator);
-            else
+            if (registrations_.find(key) != std::end(registrations_)
+                || communicators_.find(key) != std::end(communicators_))
+            {
                 throw std::runtime_error(key + " is already registered");
+            }
+
+            registration(*all_.algo);
+
+            if constexpr (Type == CommunicatorType::GhostField)
+            {
+                QuantityCommunicator communicator;
+                registration(*communicator.algo);
+                communicators_[key] = std::move(communicator);
+            }
+
+            registrations_[key] = std::move(registration);
+        }
+
+
+
+
+        void addSchedule_(QuantityCommunicator& communicator,
+                          std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
+                          std::shared_ptr<SAMRAI::hier::PatchLevel>& level)
+        {
+            auto& algo       = communicator.algo;
+            auto levelNumber = level->getLevelNumber();
+
+
+            // for GhostField we need schedules that take on the level where there is an overlap
+            // (there is always for patches lying inside the level)
+            // and goes to coarser level where there is not (patch lying on the level border)
+            if constexpr (Type == CommunicatorType::GhostField)
+            {
+                auto schedule = algo->createSchedule(
+                    level, level->getNextCoarserHierarchyLevelNumber(), hierarchy);
+                communicator.add(schedule, levelNumber);
+            }
+
+            // this createSchedule overload is used to initialize fields.
+            // note that here we must take that createsSchedule() overload and put nullptr as
+            // src since we want to take from coarser level everywhere. using the createSchedule
+            // overload that takes level, next_coarser_level only would result in interior ghost
+            // nodes to be filled with interior of neighbor patches but there is nothing there.
+            else if constexpr (Type == CommunicatorType::InitField)
+            {
+                communicator.add(algo->createSchedule(level, nullptr, levelNumber - 1, hierarchy),
+                                 levelNumber);
+            }
+
+
+            // here we create the schedule that will intialize the particles that lie within the
+            // interior of the patches (no ghost, no coarse to fine). We take almost the same
+            // overload as for fields above but the version that takes a PatchLevelFillPattern.
+            // Here the PatchLevelInteriorFillPattern is used because we want to fill particles
+            // only within the interior of the patches of the level. The reason is that filling
+            // the their ghost regions with refined particles would not ensure the ghosts to be
+            // clones of neighbor patches particles if the splitting from coarser levels is not
+            // deterministic.
+            else if constexpr (Type == CommunicatorType::InitInteriorPart)
+            {
+                communicator.add(
+                    algo->createSchedule(
+                        std::make_shared<SAMRAI::xfer::PatchLevelInteriorFillPattern>(), level,
+                        nullptr, levelNumber - 1, hierarchy),
+                    levelNumber);
+            }
+
+            // here we create a schedule that will refine particles from coarser level and put
+            // them into the level coarse to fine boundary. These are the levelGhostParticlesOld
+            // particles. we thus take the same createSchedule overload as above but pass it a
+            // PatchLevelBorderFillPattern.
+            else if constexpr (Type == CommunicatorType::LevelBorderParticles)
+            {
+                communicator.add(
+                    algo->createSchedule(
+                        std::make_shared<SAMRAI::xfer::PatchLevelBorderFillPattern>(), level,
+                        nullptr, levelNumber - 1, hierarchy),
+                    levelNumber);
+            }
+
+            // this branch is used to create a schedule that will transfer particles into the
+            // patches' ghost zones.
+            else if constexpr (Type == CommunicatorType::InteriorGhostParticles)
+            {
+                communicator.add(algo->createSchedule(level), levelNumber);
+            }
         }
 
 
@@ -256,7 +364,7 @@ namespace amr_interface
         {
             if (auto mapIter = communicators_.find(name); mapIter != std::end(communicators_))
             {
-                return mapIter->second.findSchedule(levelNumber);
+                return findSchedule_(mapIter->second, levelNumber);
             }
             else
             {
@@ -266,6 +374,52 @@ namespace amr_interface
 
 
 
+        //! the schedule of communicator for the level, made first if it is a GhostField
+        //! schedule not used yet on this registered level
+        std::optional<std::shared_ptr<SAMRAI::xfer::RefineSchedule>>
+        findSchedule_(QuantityCommunicator& communicator, int levelNumber)
+        {
+            if constexpr (Type == CommunicatorType::GhostField)
+            {
+                if (!communicator.findSchedule(levelNumber))
+                {
+                    if (auto registered = levels_.find(levelNumber);
+                        registered != std::end(levels_))
+                    {
+                        auto hierarchy = registered->second.hierarchy.lock();
+                        auto level     = registered->second.level.lock();
+                        if (hierarchy && level)
+                        {
+                            addSchedule_(communicator, hierarchy, level);
+                        }
+                    }
+                }
+            }
+
+            return communicator.findSchedule(levelNumber);
+        }
+
+
+
+        struct RegisteredLevel
+        {
+            std::weak_ptr<SAMRAI::hier::PatchHierarchy> hierarchy;
+            std::weak_ptr<SAMRAI::hier::PatchLevel> level;
+        };
+
+        //! registration of each quantity, by key, to register it again in a group
+        std::map<std::string, Registration> registrations_;
+
+        //! keys of the groups, which schedules are made when a level is registered
+        std::vector<std::string> groupKeys_;
+
+        //! levels registered for GhostField, on which schedules are made on first use
+        std::map<int, RegisteredLevel> levels_;
+
+        //! all quantities, filled together on a level
+        QuantityCommunicator all_;
+
+        //! quantities and groups filled by key, for GhostField only
         std::map<std::string, QuantityCommunicator> communicators_;
     };
 
@@ -20,6 +20,7 @@
 
 
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <utility>
 
@@ -141,17 +142,16 @@ namespace amr_interface
                                    int const levelNumber) override
         {
             auto level = hierarchy->getPatchLevel(levelNumber);
+            hierarchy_ = hierarchy;
 
-            magneticGhosts_.registerLevel(hierarchy, level);
-            electricGhosts_.registerLevel(hierarchy, level);
+            electromagGhosts_.registerLevel(hierarchy, level);
             patchGhostParticles_.registerLevel(hierarchy, level);
 
             // root level is not initialized with a schedule using coarser level data
             // so we don't create these schedules if root level
             if (levelNumber != rootLevelNumber)
             {
-                magneticInit_.registerLevel(hierarchy, level);
-                electricInit_.registerLevel(hierarchy, level);
+                electromagInit_.registerLevel(hierarchy, level);
                 interiorParticles_.registerLevel(hierarchy, level);
                 levelGhostParticlesOld_.registerLevel(hierarchy, level);
                 levelGhostParticlesNew_.registerLevel(hierarchy, level);
@@ -171,8 +171,7 @@ namespace amr_interface
                             IPhysicalModel& model, double const initDataTime) override
         {
             auto level = hierarchy->getPatchLevel(levelNumber);
-            magneticInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            electricInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
+            electromagInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             interiorParticles_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             levelGhostParticlesOld_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             copyLevelGhostOldToPushable_(*level, model);
@@ -216,12 +215,10 @@ namespace amr_interface
         {
             auto levelNumber = level.getLevelNumber();
 
-            magneticInit_.fill(levelNumber, initDataTime);
-            electricInit_.fill(levelNumber, initDataTime);
+            electromagInit_.fill(levelNumber, initDataTime);
 
-            // no need to call these :
-            // magneticGhosts_.fill(levelNumber, initDataTime);
-            // electricGhosts_.fill(levelNumber, initDataTime);
+            // no need to call this :
+            // electromagGhosts_.fill(levelNumber, initDataTime);
             // because the SAMRAI schedules in the 'init' communicators
             // already fill the patch ghost box from the neighbor interior box.
             // so ghost nodes are already filled .
@@ -262,7 +259,7 @@ namespace amr_interface
         virtual void fillMagneticGhosts(VecFieldT& B, int const levelNumber,
                                         double const fillTime) override
         {
-            magneticGhosts_.fill(B, levelNumber, fillTime);
+            electromagGhosts_.fill(B, levelNumber, fillTime);
         }
 
 
@@ -271,7 +268,23 @@ namespace amr_interface
         virtual void fillElectricGhosts(VecFieldT& E, int const levelNumber,
                                         double const fillTime) override
         {
-            electricGhosts_.fill(E, levelNumber, fillTime);
+            electromagGhosts_.fill(E, levelNumber, fillTime);
+        }
+
+
+
+
+        /**
+         * @brief see IMessenger::fillElectromagGhosts for documentation
+         *
+         * Note on the HybridHybrid version:
+         * The function throws if E and B have not been registered together in the
+         * ghostElectromag field of the HybridMessengerInfo
+         */
+        virtual void fillElectromagGhosts(VecFieldT& E, VecFieldT& B, int const levelNumber,
+                                          double const fillTime) override
+        {
+            electromagGhosts_.fillGroup(electromagKey_(E.name(), B.name()), levelNumber, fillTime);
         }
 
 
@@ -286,9 +299,10 @@ namespace amr_interface
         {
             std::cout << "perform the ghost particle fill\n";
 
+            auto const handles = resourcesManager_->getHandles(ions);
             for (auto patch : level)
             {
-                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, handles, ions);
                 for (auto& pop : ions)
                 {
                     empty(pop.patchGhostParticles());
@@ -315,9 +329,10 @@ namespace amr_interface
             auto alpha = timeInterpCoef_(beforePushTime, afterPushTime);
 
 
+            auto const handles = resourcesManager_->getHandles(ions);
             for (auto patch : level)
             {
-                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, handles, ions);
                 auto layout      = layoutFromPatch<GridLayoutT>(*patch);
 
                 for (auto& pop : ions)
@@ -411,22 +426,16 @@ namespace amr_interface
          */
         virtual void lastStep(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level) override
         {
-            auto& hybridModel = static_cast<HybridModel&>(model);
+            auto& ions         = static_cast<HybridModel&>(model).state.ions;
+            auto const handles = resourcesManager_->getHandles(ions);
             for (auto& patch : level)
             {
-                auto& ions       = hybridModel.state.ions;
-                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, handles, ions);
                 for (auto& pop : ions)
                 {
-                    auto& levelGhostParticlesOld = pop.levelGhostParticlesOld();
-                    auto& levelGhostParticlesNew = pop.levelGhostParticlesNew();
-                    auto& levelGhostParticles    = pop.levelGhostParticles();
-
-                    core::swap(levelGhostParticlesNew, levelGhostParticlesOld);
-                    core::empty(levelGhostParticlesNew);
-                    core::empty(levelGhostParticles);
-                    std::copy(std::begin(levelGhostParticlesOld), std::end(levelGhostParticlesOld),
-                              std::back_inserter(levelGhostParticles));
+                    core::swap(pop.levelGhostParticlesNew(), pop.levelGhostParticlesOld());
+                    core::empty(pop.levelGhostParticlesNew());
+                    copyLevelGhostOldToPushable_(pop);
                 }
             }
         }
@@ -443,16 +452,25 @@ namespace amr_interface
          * level needs to time interpolate the electromagnetic field at its ghost nodes, this level
          * will have its model EM field at t=n+1 and thanks to this methods, the t=n field will be
          * in the messenger.
+         *
+         * The t=n field is only read to fill the ghosts of the next finer level, so the copy is
+         * skipped when the level is the finest one. A finer level can only be created at a
+         * synchronization time, after which this level is advanced, and thus copied, before the
+         * finer level is.
          */
         virtual void prepareStep(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level) final
         {
-            auto& hybridModel = static_cast<HybridModel&>(model);
-            for (auto& patch : level)
+            if (!hasFinerLevel_(level))
             {
-                auto dataOnPatch
-                    = resourcesManager_->setOnPatch(*patch, hybridModel.state.electromag, EM_old_);
+                return;
+            }
 
-                auto& EM = hybridModel.state.electromag;
+            auto& hybridModel  = static_cast<HybridModel&>(model);
+            auto& EM           = hybridModel.state.electromag;
+            auto const handles = resourcesManager_->getHandles(EM, EM_old_);
+            for (auto& patch : level)
+            {
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, handles, EM, EM_old_);
                 EM_old_.copyData(EM);
             }
         }
@@ -467,8 +485,7 @@ namespace amr_interface
             auto levelNumber  = level.getLevelNumber();
             assert(levelNumber == 0);
 
-            magneticGhosts_.fill(levelNumber, initDataTime);
-            electricGhosts_.fill(levelNumber, initDataTime);
+            electromagGhosts_.fill(levelNumber, initDataTime);
             patchGhostParticles_.fill(levelNumber, initDataTime);
 
             // at some point in the future levelGhostParticles could be filled with injected
@@ -488,10 +505,25 @@ namespace amr_interface
 
 
             makeCommunicators_(info->ghostElectric, info->modelElectric, VecFieldDescriptor{Eold},
-                               electricGhosts_);
+                               electromagGhosts_);
 
             makeCommunicators_(info->ghostMagnetic, info->modelMagnetic, VecFieldDescriptor{Bold},
-                               magneticGhosts_);
+                               electromagGhosts_);
+
+            for (auto const& [electric, magnetic] : info->ghostElectromag)
+            {
+                electromagGhosts_.addGroup(electromagKey_(electric.vecName, magnetic.vecName),
+                                           {electric.vecName, magnetic.vecName});
+            }
+        }
+
+
+
+
+        //! key of the group of communicators filling the ghosts of E and B together
+        static std::string electromagKey_(std::string const& electric, std::string const& magnetic)
+        {
+            return electric + "_" + magnetic;
         }
 
 
@@ -506,10 +538,10 @@ namespace amr_interface
                 return keys;
             };
 
-            makeCommunicators_(info->initMagnetic, fieldRefineOp_, magneticInit_,
+            makeCommunicators_(info->initMagnetic, fieldRefineOp_, electromagInit_,
                                makeKeys(info->initMagnetic));
 
-            makeCommunicators_(info->initElectric, fieldRefineOp_, electricInit_,
+            makeCommunicators_(info->initElectric, fieldRefineOp_, electromagInit_,
                                makeKeys(info->initElectric));
 
 
@@ -577,19 +609,14 @@ namespace amr_interface
 
         void copyLevelGhostOldToPushable_(SAMRAI::hier::PatchLevel& level, IPhysicalModel& model)
         {
-            auto& hybridModel = static_cast<HybridModel&>(model);
+            auto& ions         = static_cast<HybridModel&>(model).state.ions;
+            auto const handles = resourcesManager_->getHandles(ions);
             for (auto& patch : level)
             {
-                auto& ions       = hybridModel.state.ions;
-                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, handles, ions);
                 for (auto& pop : ions)
                 {
-                    auto& levelGhostParticlesOld = pop.levelGhostParticlesOld();
-                    auto& levelGhostParticles    = pop.levelGhostParticles();
-
-                    core::empty(levelGhostParticles);
-                    std::copy(std::begin(levelGhostParticlesOld), std::end(levelGhostParticlesOld),
-                              std::back_inserter(levelGhostParticles));
+                    copyLevelGhostOldToPushable_(pop);
                 }
             }
         }
@@ -597,13 +624,29 @@ namespace amr_interface
 
 
 
+        /** levelGhostParticles are pushed while levelGhostParticlesOld are still projected to
+         * get the moments on level ghost nodes, so they need their own copy of the particles.
+         * The copy assignment reuses the storage levelGhostParticles kept from previous
+         * subcycles, and the swap of old and new particles in lastStep() only exchanges
+         * buffers, so that no allocation is needed once the buffers are large enough.
+         */
+        template<typename IonPopulation>
+        static void copyLevelGhostOldToPushable_(IonPopulation& pop)
+        {
+            pop.levelGhostParticles() = pop.levelGhostParticlesOld();
+        }
+
+
+
+
         void computeIonMoments_(SAMRAI::hier::PatchLevel& level, IPhysicalModel& model)
         {
-            auto& hybridModel = static_cast<HybridModel&>(model);
+            auto& hybridModel  = static_cast<HybridModel&>(model);
+            auto& ions         = hybridModel.state.ions;
+            auto const handles = resourcesManager_->getHandles(ions);
             for (auto& patch : level)
             {
-                auto& ions       = hybridModel.state.ions;
-                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, handles, ions);
                 auto layout      = layoutFromPatch<GridLayoutT>(*patch);
 
                 for (auto& pop : ions)
@@ -628,6 +671,16 @@ namespace amr_interface
 
 
 
+        //! true if the hierarchy has a level finer than the given one, or if it is unknown
+        bool hasFinerLevel_(SAMRAI::hier::PatchLevel const& level) const
+        {
+            auto hierarchy = hierarchy_.lock();
+            return !hierarchy || level.getLevelNumber() < hierarchy->getFinestLevelNumber();
+        }
+
+
+
+
         double timeInterpCoef_(double const beforePushTime, double const afterPushTime)
         {
             return (afterPushTime - beforePushTime)
@@ -645,6 +698,9 @@ namespace amr_interface
         //! ResourceManager shared with other objects (like the HybridModel)
         std::shared_ptr<ResourcesManagerT> resourcesManager_;
 
+        //! hierarchy of the registered levels, used to know if a level has a finer one
+        std::weak_ptr<SAMRAI::hier::PatchHierarchy> hierarchy_;
+
 
         int const firstLevel_;
         double beforePushCoarseTime_;
@@ -653,17 +709,11 @@ namespace amr_interface
         core::Interpolator<dimension, interpOrder> interpolate_;
 
 
-        //! store communicators for magnetic fields that need ghosts to be filled
-        Communicators<CommunicatorType::GhostField> magneticGhosts_;
-
-        //! store communicators for magnetic fields that need to be initialized
-        Communicators<CommunicatorType::InitField> magneticInit_;
-
-        //! store refiners for electric fields that need ghosts to be filled
-        Communicators<CommunicatorType::GhostField> electricGhosts_;
+        //! store communicators for electric and magnetic fields that need ghosts to be filled
+        Communicators<CommunicatorType::GhostField> electromagGhosts_;
 
-        //! store communicators for electric fields that need to be initializes
-        Communicators<CommunicatorType::InitField> electricInit_;
+        //! store communicators for electric and magnetic fields that need to be initialized
+        Communicators<CommunicatorType::InitField> electromagInit_;
 
         // algo and schedule used to initialize domain particles
         // from coarser level using particleRefineOp<domain>
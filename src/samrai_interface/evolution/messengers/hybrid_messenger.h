@@ -47,6 +47,7 @@ namespace amr_interface
      *
      * - fillMagneticGhosts()
      * - fillElectricGhosts()
+     * - fillElectromagGhosts()
      * - fillIonGhostParticles()
      * - fillIonMomentGhosts()
      *
@@ -276,6 +277,22 @@ namespace amr_interface
         }
 
 
+        /**
+         * @brief fillElectromagGhosts is called by a ISolver solving hybrid equations to fill
+         * the ghost nodes of an electric and a magnetic field at once, i.e. with one message
+         * between neighbor patches instead of two. E and B must have been registered together.
+         * @param E is the electric field for which ghost nodes will be filled
+         * @param B is the magnetic field for which ghost nodes will be filled
+         * @param levelNumber
+         * @param fillTime
+         */
+        void fillElectromagGhosts(VecFieldT& E, VecFieldT& B, int const levelNumber,
+                                  double const fillTime)
+        {
+            strat_->fillElectromagGhosts(E, B, levelNumber, fillTime);
+        }
+
+
 
         /**
          * @brief fillIonGhostParticles is called by a ISolver solving hybrid equations to fill the
@@ -53,6 +53,18 @@ namespace amr_interface
 
 
 
+    /**
+     * @brief ElectromagDescriptor pairs the descriptors of an electric and a magnetic field whose
+     * ghost nodes are filled together.
+     */
+    struct ElectromagDescriptor
+    {
+        VecFieldDescriptor electric;
+        VecFieldDescriptor magnetic;
+    };
+
+
+
     using FieldDescriptor      = std::string;
     using PopulationDescriptor = std::string;
 
@@ -91,6 +103,11 @@ namespace amr_interface
         std::vector<VecFieldDescriptor> ghostElectric;
 
 
+        //! electric and magnetic quantities, also in ghostElectric and ghostMagnetic, whose ghost
+        //! nodes will be communicated together by HybridMessenger::fillElectromagGhosts()
+        std::vector<ElectromagDescriptor> ghostElectromag;
+
+
 
         virtual ~HybridMessengerInfo() = default;
     };
@@ -71,6 +71,9 @@ namespace amr_interface
             = 0;
         virtual void fillElectricGhosts(VecFieldT& E, int const levelNumber, double const fillTime)
             = 0;
+        virtual void fillElectromagGhosts(VecFieldT& E, VecFieldT& B, int const levelNumber,
+                                          double const fillTime)
+            = 0;
         virtual void fillIonGhostParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                            double const fillTime)
             = 0;
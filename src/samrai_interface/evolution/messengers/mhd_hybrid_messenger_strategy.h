@@ -103,6 +103,10 @@ namespace amr_interface
                                         double const fillTime) override
         {
         }
+        virtual void fillElectromagGhosts(VecFieldT& E, VecFieldT& B, int const levelNumber,
+                                          double const fillTime) override
+        {
+        }
         virtual void fillIonGhostParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                            double const fillTime) override
         {
@@ -63,6 +63,11 @@ namespace amr_interface
 
 
 
+        //! remove drops the schedule of the given level number, if there is one
+        void remove(int levelNumber) { schedules_.erase(levelNumber); }
+
+
+
         std::unique_ptr<SAMRAI::xfer::RefineAlgorithm> algo;
 
     private:
@@ -73,13 +78,15 @@ namespace amr_interface
 
 
     /**
-     * @brief makeGhostRefiner creates a QuantityRefiner for ghost filling of a VecField.
+     * @brief registerRefines registers on the given algorithm the ghost filling of a VecField.
      *
-     * The method basically calls registerRefine() on the QuantityRefiner algorithm,
-     * passing it the IDs of the ghost, model and old model patch datas associated to each component
-     * of the vector field.
+     * The method basically calls registerRefine() on the algorithm, passing it the IDs of the
+     * ghost, model and old model patch datas associated to each component of the vector field.
+     * Several quantities may be registered on the same algorithm, so that its schedules fill
+     * them all at once.
      *
      *
+     * @param algo is the RefineAlgorithm on which refinements are registered
      * @param ghost is the VecFieldDescriptor of the VecField that needs its ghost nodes filled
      * @param model is the VecFieldDescriptor of the model VecField from which data is taken (at
      * time t_coarse+dt_coarse)
@@ -88,96 +95,82 @@ namespace amr_interface
      * @param rm is the ResourcesManager
      * @param refineOp is the spatial refinement operator
      * @param timeOp is the time interpolator
-     *
-     * @return the function returns a QuantityRefiner which may be stored in a RefinerPool and to
-     * which later schedules will be added.
      */
     template<typename ResourcesManager>
-    QuantityCommunicator
-    makeCommunicator(VecFieldDescriptor const& ghost, VecFieldDescriptor const& model,
-                     VecFieldDescriptor const& oldModel, ResourcesManager const& rm,
-                     std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp,
-                     std::shared_ptr<SAMRAI::hier::TimeInterpolateOperator> timeOp)
+    void registerRefines(SAMRAI::xfer::RefineAlgorithm& algo, VecFieldDescriptor const& ghost,
+                         VecFieldDescriptor const& model, VecFieldDescriptor const& oldModel,
+                         ResourcesManager const& rm,
+                         std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp,
+                         std::shared_ptr<SAMRAI::hier::TimeInterpolateOperator> timeOp)
     {
-        QuantityCommunicator refiner;
-
-        auto registerRefine = [&rm, &refiner, &refineOp, &timeOp](std::string const& model,
-                                                                  std::string const& ghost,
-                                                                  std::string const& oldModel) {
-            auto src_id  = rm->getID(model);
-            auto dest_id = rm->getID(ghost);
-            auto old_id  = rm->getID(oldModel);
-
-            if (src_id && dest_id && old_id)
+        auto registerRefine = [&rm, &algo, &refineOp, &timeOp](std::string const& ghost,
+                                                               std::string const& oldModel,
+                                                               std::string const& model) {
+            auto ghost_id = rm->getID(ghost);
+            auto old_id   = rm->getID(oldModel);
+            auto model_id = rm->getID(model);
+
+            if (ghost_id && old_id && model_id)
             {
                 // dest, src, old, new, scratch
-                refiner.algo->registerRefine(*dest_id, // dest
-                                             *src_id,  // source at same time
-                                             *old_id,  // source at past time (for time interp)
-                                             *src_id,  // source at future time (for time interp)
-                                             *dest_id, // scratch
-                                             refineOp, timeOp);
+                algo.registerRefine(*ghost_id, // dest
+                                    *ghost_id, // source at same time
+                                    *old_id,   // source at past time (for time interp)
+                                    *model_id, // source at future time (for time interp)
+                                    *ghost_id, // scratch
+                                    refineOp, timeOp);
             }
         };
 
         // register refine operators for each component of the vecfield
-        registerRefine(ghost.xName, model.xName, oldModel.xName);
-        registerRefine(ghost.yName, model.yName, oldModel.yName);
-        registerRefine(ghost.zName, model.zName, oldModel.zName);
-
-        return refiner;
+        registerRefine(ghost.xName, oldModel.xName, model.xName);
+        registerRefine(ghost.yName, oldModel.yName, model.yName);
+        registerRefine(ghost.zName, oldModel.zName, model.zName);
     }
 
 
 
 
     /**
-     * @brief makeInitRefiner is similar to makeGhostRefiner except the registerRefine() that is
+     * @brief registerRefines is similar to the ghost overload except the registerRefine() that is
      * called is the one that allows initialization of a vector field quantity.
      */
     template<typename ResourcesManager>
-    QuantityCommunicator makeCommunicator(VecFieldDescriptor const& name,
-                                          ResourcesManager const& rm,
-                                          std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp)
+    void registerRefines(SAMRAI::xfer::RefineAlgorithm& algo, VecFieldDescriptor const& name,
+                         ResourcesManager const& rm,
+                         std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp)
     {
-        QuantityCommunicator refiner;
-
-        auto registerRefine = [&refiner, &rm, &refineOp](std::string name) //
+        auto registerRefine = [&algo, &rm, &refineOp](std::string name) //
         {
             auto id = rm->getID(name);
             if (id)
             {
-                refiner.algo->registerRefine(*id, *id, *id, refineOp);
+                algo.registerRefine(*id, *id, *id, refineOp);
             }
         };
 
         registerRefine(name.xName);
         registerRefine(name.yName);
         registerRefine(name.zName);
-
-        return refiner;
     }
 
 
 
 
     /**
-     * @brief makeInitRefiner is similar to makeGhostRefiner except the registerRefine() that is
+     * @brief registerRefines is similar to the ghost overload except the registerRefine() that is
      * called is the one that allows initialization of a field quantity.
      */
     template<typename ResourcesManager>
-    QuantityCommunicator makeCommunicator(std::string const& name, ResourcesManager const& rm,
-                                          std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp)
+    void registerRefines(SAMRAI::xfer::RefineAlgorithm& algo, std::string const& name,
+                         ResourcesManager const& rm,
+                         std::shared_ptr<SAMRAI::hier::RefineOperator> refineOp)
     {
-        QuantityCommunicator communicator;
-
         auto id = rm->getID(name);
         if (id)
         {
-            communicator.algo->registerRefine(*id, *id, *id, refineOp);
+            algo.registerRefine(*id, *id, *id, refineOp);
         }
-
-        return communicator;
     }
 
 
@@ -9,6 +9,7 @@
 
 #include "evolution/messengers/messenger.h"
 #include "evolution/messengers/messenger_info.h"
+#include "numerics/time_step/time_step_controller.h"
 #include "physical_models/physical_model.h"
 
 
@@ -74,6 +75,19 @@ namespace amr_interface
 
 
 
+        /**
+         * @brief timeStepRates returns the largest rates the time step of the given level must
+         * resolve, on the patches of the level owned by this MPI rank. The default
+         * implementation does not constrain the time step.
+         */
+        virtual core::TimeStepRates timeStepRates(IPhysicalModel&, SAMRAI::hier::PatchLevel&)
+        {
+            return {};
+        }
+
+
+
+
         /**
          * @brief allocate is used to allocate ISolver variables previously registered to the
          * ResourcesManager of the given model, onto the given Patch, at the given time.
@@ -6,6 +6,7 @@
 #include <SAMRAI/hier/Patch.h>
 
 
+#include "data_provider.h"
 #include "evolution/messengers/hybrid_messenger.h"
 #include "evolution/messengers/hybrid_messenger_info.h"
 #include "evolution/solvers/solver.h"
@@ -21,14 +22,25 @@ namespace amr_interface
         using Electromag = decltype(std::declval<HybridModel>().state.electromag);
         using IonsT      = decltype(std::declval<HybridModel>().state.ions);
         using VecFieldT  = decltype(std::declval<HybridModel>().state.electromag.E);
+        using GridLayout = typename HybridModel::gridLayout_type;
+
+        static constexpr auto dimension = HybridModel::dimension;
+
+        //! smallest ion density used to compute the whistler rate
+        double densityFloor_;
 
         Electromag electromagPred_{"EMPred"};
         Electromag electromagAvg_{"EMAvg"};
 
 
     public:
-        explicit SolverPPC()
+        /**
+         * @brief builds the solver from a dictionary giving its parameters:
+         * - densityFloor: the smallest ion density used to compute the whistler rate
+         */
+        explicit SolverPPC(PHARE::initializer::PHAREDict<dimension> dict)
             : ISolver{"PPC"}
+            , densityFloor_{dict["densityFloor"].template to<double>()}
         {
         }
 
@@ -47,6 +59,8 @@ namespace amr_interface
             auto const& Epred = electromagPred_.E;
             auto const& Bpred = electromagPred_.B;
 
+            // Epred and Bpred are not in ghostElectromag: each stage needs the ghost nodes of
+            // Bpred to compute Epred, so they cannot be filled together
             modelInfo.ghostElectric.emplace_back(Epred);
             modelInfo.ghostMagnetic.emplace_back(Bpred);
         }
@@ -75,6 +89,30 @@ namespace amr_interface
 
 
 
+        virtual core::TimeStepRates timeStepRates(IPhysicalModel& model,
+                                                  SAMRAI::hier::PatchLevel& level) override
+        {
+            auto& hybridModel = dynamic_cast<HybridModel&>(model);
+            auto& electromag  = hybridModel.state.electromag;
+            auto& ions        = hybridModel.state.ions;
+
+            core::TimeStepRates rates;
+            auto const handles = hybridModel.resourcesManager->getHandles(electromag, ions);
+            for (auto& patch : level)
+            {
+                auto dataOnPatch
+                    = hybridModel.resourcesManager->setOnPatch(*patch, handles, electromag, ions);
+                auto layout = layoutFromPatch<GridLayout>(*patch);
+
+                rates = core::maxRates(
+                    rates, core::timeStepRates(layout, electromag.B, ions, densityFloor_));
+            }
+            return rates;
+        }
+
+
+
+
         virtual void advanceLevel(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
                                   int const levelNumber, IPhysicalModel& model,
                                   IMessenger& fromCoarserMessenger, const double currentTime,
@@ -97,6 +97,7 @@ namespace amr_interface
 
             modelInfo.ghostElectric.push_back(modelInfo.modelElectric);
             modelInfo.ghostMagnetic.push_back(modelInfo.modelMagnetic);
+            modelInfo.ghostElectromag.push_back({modelInfo.modelElectric, modelInfo.modelMagnetic});
 
             std::transform(std::begin(state.ions), std::end(state.ions),
                            std::back_inserter(modelInfo.interiorParticles),
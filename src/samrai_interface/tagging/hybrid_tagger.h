@@ -0,0 +1,119 @@
+#ifndef PHARE_HYBRID_TAGGER_H
+#define PHARE_HYBRID_TAGGER_H
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <SAMRAI/hier/Index.h>
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/pdat/CellData.h>
+#include <SAMRAI/pdat/CellIndex.h>
+
+#include "data_provider.h"
+#include "numerics/tagging/hybrid_tagging_criteria.h"
+#include "tagging/tagger.h"
+#include "tools/amr_utils.h"
+#include "tools/patch_loop.h"
+#include "utilities/point/point.h"
+
+
+
+namespace PHARE
+{
+namespace amr_interface
+{
+    /**
+     * @brief HybridTagger tags the cells of a level of a HybridModel according to
+     * core::HybridTaggingCriteria: the current, the relative variation of the magnetic field and
+     * of the ion density over a cell, and the number of particles per cell.
+     *
+     * Patches are tagged concurrently when PHARE is built with OpenMP, see forEachPatch.
+     */
+    template<typename HybridModel>
+    class HybridTagger : public ITagger
+    {
+    private:
+        using GridLayoutT               = typename HybridModel::gridLayout_type;
+        using ElectromagT               = typename HybridModel::electromag_type;
+        using IonsT                     = typename HybridModel::ions_type;
+        static constexpr auto dimension = HybridModel::dimension;
+
+    public:
+        explicit HybridTagger(core::TaggingThresholds const& thresholds)
+            : criteria_{thresholds}
+        {
+        }
+
+
+        /**
+         * @brief builds the tagger from a dictionary giving the thresholds, see
+         * core::HybridTaggingCriteria
+         */
+        explicit HybridTagger(PHARE::initializer::PHAREDict<dimension> dict)
+            : criteria_{dict}
+        {
+        }
+
+
+        virtual std::string modelName() const override { return HybridModel::model_name; }
+
+
+
+
+        virtual void tag(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level,
+                         int tagIndex) override
+        {
+            auto& hybridModel = dynamic_cast<HybridModel&>(model);
+
+            forEachPatch(level, *hybridModel.resourcesManager,
+                         [this, tagIndex](SAMRAI::hier::Patch& patch, ElectromagT& electromag,
+                                          IonsT& ions) {
+                             tagPatch_(patch, electromag, ions, tagIndex);
+                         },
+                         hybridModel.state.electromag, hybridModel.state.ions);
+        }
+
+
+
+
+        virtual ~HybridTagger() = default;
+
+
+
+    private:
+        core::HybridTaggingCriteria<GridLayoutT> criteria_;
+
+
+
+        void tagPatch_(SAMRAI::hier::Patch& patch, ElectromagT& electromag, IonsT& ions,
+                       int tagIndex) const
+        {
+            auto tags = std::dynamic_pointer_cast<SAMRAI::pdat::CellData<int>>(
+                patch.getPatchData(tagIndex));
+            if (!tags)
+            {
+                throw std::runtime_error("Error - tag data must be a CellData<int>");
+            }
+
+            tags->fillAll(0);
+
+            auto layout = layoutFromPatch<GridLayoutT>(patch);
+
+            criteria_.tag(layout, electromag.B, ions,
+                          [&tags](core::Point<int, dimension> const& cell) {
+                              SAMRAI::hier::Index index{SAMRAI::tbox::Dimension{dimension}};
+                              for (auto iDim = 0u; iDim < dimension; ++iDim)
+                              {
+                                  index[iDim] = cell[iDim];
+                              }
+                              (*tags)(SAMRAI::pdat::CellIndex{index}) = 1;
+                          });
+        }
+    };
+
+
+} // namespace amr_interface
+} // namespace PHARE
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef PHARE_TAGGER_H
+#define PHARE_TAGGER_H
+
+#include <string>
+
+#include <SAMRAI/hier/PatchLevel.h>
+
+#include "physical_models/physical_model.h"
+
+
+
+namespace PHARE
+{
+namespace amr_interface
+{
+    /**
+     * @brief The ITagger is an interface for the objects the MultiPhysicsIntegrator uses to tag
+     * the cells of a level that need to be refined.
+     *
+     * Taggers are registered to the MultiPhysicsIntegrator for a range of levels, like models
+     * and solvers, and are called by applyGradientDetector().
+     */
+    class ITagger
+    {
+    public:
+        /**
+         * @brief return the name of the model the ITagger is compatible with
+         */
+        virtual std::string modelName() const = 0;
+
+
+
+        /**
+         * @brief tag sets to 1 the tags of the cells of the level that need to be refined, and to
+         * 0 the other ones. Tags are SAMRAI::pdat::CellData<int> with the given patch data index.
+         */
+        virtual void tag(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level, int tagIndex)
+            = 0;
+
+
+
+        virtual ~ITagger() = default;
+    };
+
+
+} // namespace amr_interface
+} // namespace PHARE
+
+#endif
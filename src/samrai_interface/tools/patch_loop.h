@@ -0,0 +1,99 @@
+#ifndef PHARE_AMR_TOOLS_PATCH_LOOP_H
+#define PHARE_AMR_TOOLS_PATCH_LOOP_H
+
+#include <exception>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchLevel.h>
+
+namespace PHARE
+{
+namespace amr_interface
+{
+    /** \brief forEachPatch calls fn(patch, users...) on each patch of the level, with the
+     * given resources users set on the patch.
+     *
+     * When PHARE is built with OpenMP (CMake option 'openmp'), patches are distributed among
+     * the threads of the enclosing OpenMP team. Resources users only hold pointers to the
+     * patch data, so setting one on a patch modifies it. Each thread thus sets and hands to fn
+     * its own copy of the resources users, made from the given ones, and the given users are
+     * never modified. Resources users must therefore be copy constructible, which is checked at
+     * compile time whether or not OpenMP is used. fn must only work through the users it
+     * receives, and must not write to data shared by other patches.
+     *
+     * Without OpenMP, patches are processed in order by the calling thread.
+     *
+     * The resources of the users are resolved once, with ResourcesManager::getHandles(), so
+     * that setting the users on each patch does not look up their names.
+     *
+     * An exception thrown by fn on any patch is rethrown to the caller once all threads are
+     * done.
+     */
+    template<typename ResourcesManager, typename Fn, typename... ResourcesUsers>
+    void forEachPatch(SAMRAI::hier::PatchLevel& level, ResourcesManager const& resourcesManager,
+                      Fn&& fn, ResourcesUsers const&... resourcesUsers)
+    {
+        static_assert((std::is_copy_constructible_v<ResourcesUsers> && ...),
+                      "forEachPatch copies the resources users for each thread");
+
+        std::vector<std::shared_ptr<SAMRAI::hier::Patch>> patches;
+        for (auto& patch : level)
+        {
+            patches.push_back(patch);
+        }
+
+        auto const nbrPatches = static_cast<int>(patches.size());
+        std::exception_ptr error;
+
+        auto const handles = resourcesManager.getHandles(resourcesUsers...);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::tuple<ResourcesUsers...> threadUsers{resourcesUsers...};
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (int iPatch = 0; iPatch < nbrPatches; ++iPatch)
+            {
+                try
+                {
+                    auto& patch = *patches[static_cast<std::size_t>(iPatch)];
+                    std::apply(
+                        [&](auto&... users) {
+                            auto dataOnPatch
+                                = resourcesManager.setOnPatch(patch, handles, users...);
+                            fn(patch, users...);
+                        },
+                        threadUsers);
+                }
+                catch (...)
+                {
+#ifdef _OPENMP
+#pragma omp critical(PHARE_forEachPatch_error)
+#endif
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+
+} // namespace amr_interface
+} // namespace PHARE
+
+#endif
@@ -1,9 +1,11 @@
 #ifndef PHARE_AMR_TOOLS_RESOURCES_GUARDS_H
 #define PHARE_AMR_TOOLS_RESOURCES_GUARDS_H
 
+#include "resources_handles.h"
 #include "resources_manager_utilities.h"
 
 #include <memory>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 
@@ -19,6 +21,10 @@ namespace amr_interface
      *  At construction it will take the patch, and all resourcesManagerUser object that need to
      *  be set via the ResourcesManager. Upon destruction, it will put all the previous
      *  object in an inactive state (for now it just put nullptr on them)
+     *
+     *  A ResourcesGuard modifies the resourcesUser objects it is given, not the
+     *  ResourcesManager. Guards can thus be used concurrently from several threads as long
+     *  as each thread has its own resourcesUser objects (see forEachPatch).
 
      * TODO: add the active mechanism
      */
@@ -50,14 +56,61 @@ namespace amr_interface
 
 
 
+        /**
+         *  \brief Same as above, but the resourcesUsers are set from handles given by the
+         *  ResourcesManager for them, which must outlive the guard
+         */
+        ResourcesGuard(SAMRAI::hier::Patch const& patch, ResourcesManager const& resourcesManager,
+                       ResourcesHandles const& handles, ResourcesUsers&... resourcesUsers)
+            : resourcesUsers_{resourcesUsers...}
+            , patch_{patch}
+            , resourcesManager_{resourcesManager}
+            , handles_{&handles}
+        {
+            try
+            {
+                std::apply(
+                    [this](auto&... user) {
+                        resourcesManager_.setResourcesFromHandles_(*handles_, UseResourcePtr{},
+                                                                   patch_, user...);
+                    },
+                    resourcesUsers_);
+            }
+            catch (std::runtime_error const&)
+            {
+                // handles that do not match the users may have set some of them
+                std::apply(
+                    [this](auto&... user) {
+                        ((resourcesManager_.setResources_(user, UseNullPtr{}, patch_)), ...);
+                    },
+                    resourcesUsers_);
+                throw;
+            }
+        }
+
+
+
+
         ~ResourcesGuard()
         {
             // set nullptr to all users in resourcesUsers_
-            std::apply(
-                [this](auto&... user) {
-                    ((resourcesManager_.setResources_(user, UseNullPtr{}, patch_)), ...);
-                },
-                resourcesUsers_);
+            if (handles_ != nullptr)
+            {
+                std::apply(
+                    [this](auto&... user) {
+                        resourcesManager_.setResourcesFromHandles_(*handles_, UseNullPtr{},
+                                                                   patch_, user...);
+                    },
+                    resourcesUsers_);
+            }
+            else
+            {
+                std::apply(
+                    [this](auto&... user) {
+                        ((resourcesManager_.setResources_(user, UseNullPtr{}, patch_)), ...);
+                    },
+                    resourcesUsers_);
+            }
         }
 
 
@@ -76,6 +129,7 @@ namespace amr_interface
         std::tuple<ResourcesUsers&...> resourcesUsers_;
         SAMRAI::hier::Patch const& patch_;
         ResourcesManager const& resourcesManager_;
+        ResourcesHandles const* handles_{nullptr};
     };
 } // namespace amr_interface
 } // namespace PHARE
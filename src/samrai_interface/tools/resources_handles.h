@@ -0,0 +1,49 @@
+#ifndef PHARE_AMR_TOOLS_RESOURCES_HANDLES_H
+#define PHARE_AMR_TOOLS_RESOURCES_HANDLES_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace PHARE
+{
+namespace amr_interface
+{
+    /** \brief ResourceHandle is a Field or ParticleArray resource of a ResourcesUser once
+     * resolved by the ResourcesManager: the ID of its patch data, and its index in the
+     * properties the ResourcesUser gives for it (getFieldNamesAndQuantities() or
+     * getParticleArrayNames()). The name is kept for ResourcesUsers that can only set their
+     * buffers by name.
+     */
+    struct ResourceHandle
+    {
+        int id;
+        std::size_t index;
+        std::string name;
+    };
+
+
+
+
+    /** \brief ResourcesHandles holds the resolved resources of one or several ResourcesUsers,
+     * as returned by ResourcesManager::getHandles().
+     *
+     * Resources are stored in the order the ResourcesManager walks the ResourcesUsers: for each
+     * user, its fields, its particle arrays, then its runtime and compile-time sub-resources
+     * users. counts gives, in the same order, the number of fields, of particle arrays and of
+     * runtime sub-resources users of each user, which is all that is needed to walk the users
+     * again without asking for their resources names.
+     *
+     * Handles stay valid for any ResourcesUsers with the same resources, e.g. the copies of the
+     * users made by forEachPatch.
+     */
+    struct ResourcesHandles
+    {
+        std::vector<ResourceHandle> resources;
+        std::vector<std::size_t> counts;
+    };
+
+} // namespace amr_interface
+} // namespace PHARE
+
+#endif
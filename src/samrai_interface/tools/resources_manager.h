@@ -5,6 +5,7 @@
 #include "hybrid/hybrid_quantities.h"
 #include "particle_resource.h"
 #include "resources_guards.h"
+#include "resources_handles.h"
 #include "resources_manager_utilities.h"
 
 
@@ -91,6 +92,12 @@ namespace amr_interface
      *
      * obj1 and obj2 become unusable again at the end of the scope of dataOnPatch
      *
+     * Setting users on a patch this way looks up the names of their resources. Loops over
+     * patches should rather resolve them once with getHandles() and give the handles to
+     * setOnPatch:
+     *
+     * auto handles = getHandles(obj1, obj2);
+     * for each patch: dataOnPatch = setOnPatch(patch, handles, obj1, obj2);
      *
      */
     template<typename GridLayoutT>
@@ -214,10 +221,18 @@ namespace amr_interface
          *
          * now obj1, obj2 data containers contain data defined on the given patch.
          * At the end of the scope of dataOnPatch, obj1 and obj2 will become unusable again
+         *
+         * This only reads the ResourcesManager, so that several threads can set different
+         * resources users on different patches concurrently (see forEachPatch)
+         *
+         * ResourcesHandles are not resources users, they select the overload below.
          */
-        template<typename... ResourcesUsers>
+        template<typename... ResourcesUsers,
+                 typename = std::enable_if_t<
+                     (!std::is_same_v<std::remove_const_t<ResourcesUsers>, ResourcesHandles>
+                      && ...)>>
         constexpr ResourcesGuard<ResourcesManager, ResourcesUsers...>
-        setOnPatch(SAMRAI::hier::Patch const& patch, ResourcesUsers&... resourcesUsers)
+        setOnPatch(SAMRAI::hier::Patch const& patch, ResourcesUsers&... resourcesUsers) const
         {
             return ResourcesGuard<ResourcesManager, ResourcesUsers...>{patch, *this,
                                                                        resourcesUsers...};
@@ -225,6 +240,35 @@ namespace amr_interface
 
 
 
+        /** \brief getHandles resolves the resources of the given ResourcesUsers, i.e. finds the
+         * ID of the patch data of each of them, so that setOnPatch() can later set the users on
+         * a patch from these IDs, without looking up their names.
+         */
+        template<typename... ResourcesUsers>
+        ResourcesHandles getHandles(ResourcesUsers const&... resourcesUsers) const
+        {
+            ResourcesHandles handles;
+            (this->getHandles_(resourcesUsers, handles), ...);
+            return handles;
+        }
+
+
+
+        /** \brief set all passed resources on given Patch from their handles, which must have
+         * been obtained from getHandles() with the same users, or with users having the same
+         * resources, and must outlive the returned guard.
+         */
+        template<typename... ResourcesUsers>
+        ResourcesGuard<ResourcesManager, ResourcesUsers...>
+        setOnPatch(SAMRAI::hier::Patch const& patch, ResourcesHandles const& handles,
+                   ResourcesUsers&... resourcesUsers) const
+        {
+            return ResourcesGuard<ResourcesManager, ResourcesUsers...>{patch, *this, handles,
+                                                                       resourcesUsers...};
+        }
+
+
+
         /** @brief getTime is used to get the time of the Resources associated with the given
          * ResourcesUser on the given patch.
          */
@@ -361,6 +405,194 @@ namespace amr_interface
         }
 
 
+        template<typename ResourcesUser>
+        void getHandles_(ResourcesUser const& obj, ResourcesHandles& handles) const
+        {
+            if constexpr (has_field<ResourcesUser>::value)
+            {
+                getPropertiesHandles_(obj.getFieldNamesAndQuantities(), handles);
+            }
+
+            if constexpr (has_particles<ResourcesUser>::value)
+            {
+                getPropertiesHandles_(obj.getParticleArrayNames(), handles);
+            }
+
+            if constexpr (has_runtime_subresourceuser_list<ResourcesUser>::value)
+            {
+                auto&& resourcesUsers = obj.getRunTimeResourcesUserList();
+                handles.counts.push_back(resourcesUsers.size());
+                for (auto const& resourcesUser : resourcesUsers)
+                {
+                    this->getHandles_(resourcesUser, handles);
+                }
+            }
+
+            if constexpr (has_compiletime_subresourcesuser_list<ResourcesUser>::value)
+            {
+                auto&& subResources = obj.getCompileTimeResourcesUserList();
+
+                std::apply(
+                    [this, &handles](auto const&... subResource) {
+                        (this->getHandles_(subResource, handles), ...);
+                    },
+                    subResources);
+            }
+        }
+
+
+
+        template<typename ResourcesProperties>
+        void getPropertiesHandles_(ResourcesProperties const& resourcesProperties,
+                                   ResourcesHandles& handles) const
+        {
+            handles.counts.push_back(resourcesProperties.size());
+
+            std::size_t index = 0;
+            for (auto const& properties : resourcesProperties)
+            {
+                auto const& resourceInfoIt = nameToResourceInfo_.find(properties.name);
+                if (resourceInfoIt == nameToResourceInfo_.end())
+                {
+                    throw std::runtime_error("Resources not found !");
+                }
+                handles.resources.push_back({resourceInfoIt->second.id, index++, properties.name});
+            }
+        }
+
+
+
+
+        //! position of the next resource and of the next count to read in ResourcesHandles
+        struct HandlesCursor
+        {
+            std::size_t resource = 0;
+            std::size_t count    = 0;
+        };
+
+
+        static std::size_t nextCount_(ResourcesHandles const& handles, HandlesCursor& cursor)
+        {
+            if (cursor.count >= handles.counts.size())
+            {
+                throw std::runtime_error("Error - resources handles do not match the users");
+            }
+            return handles.counts[cursor.count++];
+        }
+
+
+
+        /** \brief sets all the given ResourcesUsers from handles, walking them as getHandles()
+         * did when resolving the handles
+         */
+        template<typename NullOrResourcePtr, typename... ResourcesUsers>
+        void setResourcesFromHandles_(ResourcesHandles const& handles,
+                                      NullOrResourcePtr nullOrResourcePtr,
+                                      SAMRAI::hier::Patch const& patch,
+                                      ResourcesUsers&... resourcesUsers) const
+        {
+            HandlesCursor cursor;
+            (this->setResources_(resourcesUsers, nullOrResourcePtr, patch, handles, cursor), ...);
+
+            if (cursor.resource != handles.resources.size()
+                || cursor.count != handles.counts.size())
+            {
+                throw std::runtime_error("Error - resources handles do not match the users");
+            }
+        }
+
+
+
+        template<typename ResourcesUser, typename NullOrResourcePtr>
+        void setResources_(ResourcesUser& obj, NullOrResourcePtr nullOrResourcePtr,
+                           SAMRAI::hier::Patch const& patch, ResourcesHandles const& handles,
+                           HandlesCursor& cursor) const
+        {
+            if constexpr (has_field<ResourcesUser>::value)
+            {
+                setHandledResources_(obj, UserFieldType<GridLayoutT, ResourcesUser>{}, patch,
+                                     handles, cursor, nullOrResourcePtr);
+            }
+
+            if constexpr (has_particles<ResourcesUser>::value)
+            {
+                setHandledResources_(obj, UserParticleType<ResourcesUser>{}, patch, handles,
+                                     cursor, nullOrResourcePtr);
+            }
+
+            if constexpr (has_runtime_subresourceuser_list<ResourcesUser>::value)
+            {
+                auto&& resourcesUsers = obj.getRunTimeResourcesUserList();
+                if (resourcesUsers.size() != nextCount_(handles, cursor))
+                {
+                    throw std::runtime_error("Error - resources handles do not match the users");
+                }
+                for (auto& resourcesUser : resourcesUsers)
+                {
+                    this->setResources_(resourcesUser, nullOrResourcePtr, patch, handles, cursor);
+                }
+            }
+
+            if constexpr (has_compiletime_subresourcesuser_list<ResourcesUser>::value)
+            {
+                auto&& subResources = obj.getCompileTimeResourcesUserList();
+
+                std::apply(
+                    [&](auto&... subResource) {
+                        (this->setResources_(subResource, nullOrResourcePtr, patch, handles,
+                                             cursor),
+                         ...);
+                    },
+                    subResources);
+            }
+        }
+
+
+
+        /** \brief sets the buffers of the ResourcesUser of type ResourcesType from their handles.
+         * The patch data is taken by ID and known to be a ResourcesType::patch_data_type since
+         * it was registered so.
+         */
+        template<typename ResourcesUser, typename ResourcesType, typename RequestedPtr>
+        void setHandledResources_(ResourcesUser& obj, ResourcesType,
+                                  SAMRAI::hier::Patch const& patch,
+                                  ResourcesHandles const& handles, HandlesCursor& cursor,
+                                  RequestedPtr) const
+        {
+            using ResourcePtr = typename ResourcesType::internal_type_ptr;
+
+            auto const nbrResources = nextCount_(handles, cursor);
+            if (cursor.resource + nbrResources > handles.resources.size())
+            {
+                throw std::runtime_error("Error - resources handles do not match the users");
+            }
+
+            for (std::size_t iResource = 0; iResource < nbrResources; ++iResource)
+            {
+                auto const& handle = handles.resources[cursor.resource++];
+
+                ResourcePtr data = nullptr;
+                if constexpr (std::is_same_v<RequestedPtr, UseResourcePtr>)
+                {
+                    auto const& patchData = patch.getPatchData(handle.id);
+                    data = static_cast<typename ResourcesType::patch_data_type*>(patchData.get())
+                               ->getPointer();
+                }
+
+                if constexpr (has_indexed_buffers<ResourcesUser, ResourcePtr>::value)
+                {
+                    obj.setBuffer(handle.index, data);
+                }
+                else
+                {
+                    obj.setBuffer(handle.name, data);
+                }
+            }
+        }
+
+
+
+
         // The function getResourcesPointer_ is the one that depending
         // on NullOrResourcePtr will choose to return
         // the real pointer or a nullptr to the correct type.
@@ -3,6 +3,7 @@
 
 #include "utilities/meta/meta_utilities.h"
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -93,6 +94,27 @@ namespace amr_interface
 
 
 
+    template<typename ResourcesUser, typename ResourcePtr, typename Attempt = void>
+    struct has_indexed_buffers : std::false_type
+    {
+    };
+
+
+    /** @brief has_indexed_buffers is a compile-time function that returns true if the given
+     * ResourcesUser can set its buffers of type ResourcePtr from their index in its resources
+     * properties, and not only from their names.
+     */
+    template<typename ResourcesUser, typename ResourcePtr>
+    struct has_indexed_buffers<
+        ResourcesUser, ResourcePtr,
+        core::tryToInstanciate<decltype(std::declval<ResourcesUser>().setBuffer(
+            std::declval<std::size_t>(), std::declval<ResourcePtr>()))>> : std::true_type
+    {
+    };
+
+
+
+
     /** UseResourcePtr is used to select the resources patch data */
     struct UseResourcePtr
     {